@@ -18,6 +18,11 @@ namespace api {
 
 static const char *TAG = "api";
 
+/// Maximum number of bytes of log messages that are queued per connection, further lines are dropped.
+static const size_t LOG_BATCH_MAX_SIZE = 1024;
+/// Maximum number of bytes of log messages that are written to a connection per loop.
+static const size_t LOG_BATCH_LOOP_BUDGET = 1024;
+
 // APIServer
 void APIServer::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Home Assistant API server...");
@@ -151,7 +156,7 @@ void APIServer::on_cover_update(cover::Cover *obj) {
 
 #ifdef USE_FAN
 void APIServer::on_fan_update(fan::FanState *obj) {
-  if (obj->is_internal())
+  if (obj->is_internal() || obj->get_changed_fields() == 0)
     return;
   for (auto *c : this->clients_)
     c->send_fan_state(obj);
@@ -215,10 +220,30 @@ void APIServer::send_service_call(ServiceCallResponse &call) {
 }
 APIServer::APIServer() { global_api_server = this; }
 void APIServer::subscribe_home_assistant_state(std::string entity_id, std::function<void(std::string)> f) {
-  this->state_subs_.push_back(HomeAssistantStateSubscription{
-      .entity_id = entity_id,
-      .callback = f,
-  });
+  this->subscribe_home_assistant_state_view(std::move(entity_id), [f](const StringView &state) { f(state.str()); });
+}
+void APIServer::subscribe_home_assistant_state_view(std::string entity_id,
+                                                    std::function<void(const StringView &)> f) {
+  const uint32_t hash = fnv1_hash(entity_id);
+  auto it = std::upper_bound(
+      this->state_subs_.begin(), this->state_subs_.end(), hash,
+      [](uint32_t hash, const HomeAssistantStateSubscription &sub) { return hash < sub.entity_id_hash; });
+  this->state_subs_.insert(it, HomeAssistantStateSubscription{
+                                   .entity_id = std::move(entity_id),
+                                   .entity_id_hash = hash,
+                                   .callback = std::move(f),
+                               });
+}
+void APIServer::on_home_assistant_state(const StringView &entity_id, const StringView &state) {
+  const uint32_t hash = fnv1_hash(entity_id.data, entity_id.length);
+  auto it = std::lower_bound(
+      this->state_subs_.begin(), this->state_subs_.end(), hash,
+      [](const HomeAssistantStateSubscription &sub, uint32_t hash) { return sub.entity_id_hash < hash; });
+  for (; it != this->state_subs_.end() && it->entity_id_hash == hash; it++) {
+    // different entity IDs can have the same hash
+    if (entity_id == it->entity_id)
+      it->callback(state);
+  }
 }
 const std::vector<APIServer::HomeAssistantStateSubscription> &APIServer::get_state_subs() const {
   return this->state_subs_;
@@ -763,6 +788,8 @@ void APIConnection::loop() {
     this->send_ping_request();
   }
 
+  this->flush_log_batch_();
+
 #ifdef USE_ESP32_CAMERA
   if (this->image_reader_.available()) {
     uint32_t space = this->client_->space();
@@ -978,27 +1005,96 @@ bool APIConnection::send_climate_state(climate::ClimateDevice *climate) {
 }
 #endif
 
+static uint8_t varint_size(uint32_t value) {
+  uint8_t size = 1;
+  while (value > 0x7F) {
+    value >>= 7;
+    size++;
+  }
+  return size;
+}
+static void append_log_frame(std::vector<uint8_t> *batch, uint32_t level, const char *line, size_t line_len,
+                             bool send_failed) {
+  // LogLevel level = 1;
+  size_t payload_len = 1 + varint_size(level);
+  // string message = 3;
+  if (line_len != 0)
+    payload_len += 1 + varint_size(line_len) + line_len;
+  // bool send_failed = 4;
+  if (send_failed)
+    payload_len += 2;
+
+  APIBuffer buffer(batch);
+  buffer.write(0x00);
+  buffer.encode_varint_raw(payload_len);
+  buffer.encode_varint_raw(static_cast<uint32_t>(APIMessageType::SUBSCRIBE_LOGS_RESPONSE));
+  buffer.encode_uint32(1, level, true);
+  buffer.encode_string(3, line, line_len);
+  buffer.encode_bool(4, send_failed);
+}
+static size_t log_frame_size(size_t line_len, bool send_failed) {
+  size_t payload_len = 2 + 1 + varint_size(line_len) + line_len + (send_failed ? 2 : 0);
+  return 1 + varint_size(payload_len) + varint_size(static_cast<uint32_t>(APIMessageType::SUBSCRIBE_LOGS_RESPONSE)) +
+         payload_len;
+}
+
 bool APIConnection::send_log_message(int level, const char *tag, const char *line) {
   if (this->log_subscription_ < level)
     return false;
 
-  auto buffer = this->get_buffer();
-  // LogLevel level = 1;
-  buffer.encode_uint32(1, static_cast<uint32_t>(level));
-  // string tag = 2;
-  // buffer.encode_string(2, tag, strlen(tag));
-  // string message = 3;
-  buffer.encode_string(3, line, strlen(line));
-  bool success = this->send_buffer(APIMessageType::SUBSCRIBE_LOGS_RESPONSE);
+  // The frame is written directly to the batch: this can be called while another message is being encoded
+  // in send_buffer_, and sending here would do one tiny TCP write per log line.
+  size_t line_len = strlen(line);
+  // truncate lines that couldn't be sent within one loop's budget, they would block the batch forever
+  while (line_len > 0 && log_frame_size(line_len, false) > LOG_BATCH_LOOP_BUDGET)
+    line_len--;
+  if (this->log_dropped_ != 0 || this->log_batch_.size() + log_frame_size(line_len, false) > LOG_BATCH_MAX_SIZE) {
+    // keep dropping until the marker has been queued, so the drops are reported where they happened
+    this->log_dropped_++;
+    return false;
+  }
+  append_log_frame(&this->log_batch_, level, line, line_len, false);
+  return true;
+}
+void APIConnection::flush_log_batch_() {
+  this->send_log_batch_();
+
+  if (this->log_dropped_ != 0) {
+    char marker[48];
+    int len = snprintf(marker, sizeof(marker), "[%u log lines dropped]", static_cast<unsigned>(this->log_dropped_));
+    if (this->log_batch_.size() + log_frame_size(len, true) <= LOG_BATCH_MAX_SIZE) {
+      append_log_frame(&this->log_batch_, ESPHOME_LOG_LEVEL_WARN, marker, len, true);
+      this->log_dropped_ = 0;
+    }
+  }
+}
+void APIConnection::send_log_batch_() {
+  if (this->log_batch_.empty())
+    return;
 
-  if (!success) {
-    auto buffer = this->get_buffer();
-    // bool send_failed = 4;
-    buffer.encode_bool(4, true);
-    return this->send_buffer(APIMessageType::SUBSCRIBE_LOGS_RESPONSE);
-  } else {
-    return true;
+  // Only send whole frames, other messages are written to the client in between batches.
+  const size_t budget = std::min(this->client_->space(), LOG_BATCH_LOOP_BUDGET);
+  const uint8_t *data = this->log_batch_.data();
+  const size_t size = this->log_batch_.size();
+  size_t end = 0;
+  while (end < size) {
+    uint32_t consumed;
+    auto payload_len = proto_decode_varuint32(data + end + 1, size - end - 1, &consumed);
+    if (!payload_len.has_value())
+      break;
+    size_t frame_end = end + 1 + consumed;
+    proto_decode_varuint32(data + frame_end, size - frame_end, &consumed);
+    frame_end += consumed + *payload_len;
+    if (frame_end > budget)
+      break;
+    end = frame_end;
   }
+  if (end == 0)
+    return;
+
+  this->client_->add(reinterpret_cast<const char *>(data), end);
+  this->client_->send();
+  this->log_batch_.erase(this->log_batch_.begin(), this->log_batch_.begin() + end);
 }
 bool APIConnection::send_disconnect_request(const char *reason) {
   DisconnectRequest req;
@@ -1140,11 +1236,7 @@ void APIConnection::on_subscribe_home_assistant_states_request_(const SubscribeH
   }
 }
 void APIConnection::on_home_assistant_state_response_(const HomeAssistantStateResponse &req) {
-  for (auto &it : this->parent_->get_state_subs()) {
-    if (it.entity_id == req.get_entity_id()) {
-      it.callback(req.get_state());
-    }
-  }
+  this->parent_->on_home_assistant_state(req.get_entity_id(), req.get_state());
 }
 void APIConnection::on_execute_service_(const ExecuteServiceRequest &req) {
   ESP_LOGVV(TAG, "on_execute_service_");
@@ -70,6 +70,7 @@ class APIConnection {
 #ifdef USE_CLIMATE
   bool send_climate_state(climate::ClimateDevice *climate);
 #endif
+  /// Queue a log line for this connection, it is sent with the next batch from loop().
   bool send_log_message(int level, const char *tag, const char *line);
   bool send_disconnect_request(const char *reason);
   bool send_ping_request();
@@ -89,6 +90,10 @@ class APIConnection {
   bool valid_rx_message_type_(uint32_t msg_type);
   void read_message_(uint32_t size, uint32_t type, uint8_t *msg);
   void parse_recv_buffer_();
+  /// Send the log batch and queue the marker for dropped lines once it fits.
+  void flush_log_batch_();
+  /// Send as many whole frames of the log batch as the TCP buffer and the per-loop budget allow.
+  void send_log_batch_();
 
   // request types
   void on_hello_request_(const HelloRequest &req);
@@ -136,6 +141,8 @@ class APIConnection {
 
   std::vector<uint8_t> send_buffer_;
   std::vector<uint8_t> recv_buffer_;
+  /// Framed log messages waiting to be sent, written to the client in one add() per loop.
+  std::vector<uint8_t> log_batch_;
 
   std::string client_info_;
   ListEntitiesIterator list_entities_iterator_;
@@ -146,6 +153,8 @@ class APIConnection {
 
   bool state_subscription_{false};
   int log_subscription_{ESPHOME_LOG_LEVEL_NONE};
+  /// Number of log lines dropped because the batch was full, reported with a marker line.
+  uint32_t log_dropped_{0};
   uint32_t last_traffic_;
   bool sent_ping_{false};
   bool service_call_subscription_{false};
@@ -204,10 +213,16 @@ class APIServer : public Component, public StoringUpdateListenerController {
 
   struct HomeAssistantStateSubscription {
     std::string entity_id;
-    std::function<void(std::string)> callback;
+    uint32_t entity_id_hash;
+    std::function<void(const StringView &)> callback;
   };
 
   void subscribe_home_assistant_state(std::string entity_id, std::function<void(std::string)> f);
+  /// Subscribe to a Home Assistant state without copying it, the state is only valid during the callback.
+  void subscribe_home_assistant_state_view(std::string entity_id, std::function<void(const StringView &)> f);
+  /// Call the subscriptions for an entity ID.
+  void on_home_assistant_state(const StringView &entity_id, const StringView &state);
+  /// The subscriptions, sorted by the FNV-1 hash of their entity ID.
   const std::vector<HomeAssistantStateSubscription> &get_state_subs() const;
   const std::vector<UserServiceDescriptor *> &get_user_services() const { return this->user_services_; }
 
@@ -61,11 +61,11 @@ bool HomeAssistantStateResponse::decode_length_delimited(uint32_t field_id, cons
   switch (field_id) {
     case 1:
       // string entity_id = 1;
-      this->entity_id_ = as_string(value, len);
+      this->entity_id_ = as_string_view(value, len);
       return true;
     case 2:
       // string state = 2;
-      this->state_ = as_string(value, len);
+      this->state_ = as_string_view(value, len);
       return true;
     default:
       return false;
@@ -74,8 +74,8 @@ bool HomeAssistantStateResponse::decode_length_delimited(uint32_t field_id, cons
 APIMessageType HomeAssistantStateResponse::message_type() const {
   return APIMessageType::HOME_ASSISTANT_STATE_RESPONSE;
 }
-const std::string &HomeAssistantStateResponse::get_entity_id() const { return this->entity_id_; }
-const std::string &HomeAssistantStateResponse::get_state() const { return this->state_; }
+const StringView &HomeAssistantStateResponse::get_entity_id() const { return this->entity_id_; }
+const StringView &HomeAssistantStateResponse::get_state() const { return this->state_; }
 APIMessageType SubscribeHomeAssistantStatesRequest::message_type() const {
   return APIMessageType::SUBSCRIBE_HOME_ASSISTANT_STATES_REQUEST;
 }
@@ -61,12 +61,13 @@ class HomeAssistantStateResponse : public APIMessage {
  public:
   bool decode_length_delimited(uint32_t field_id, const uint8_t *value, size_t len) override;
   APIMessageType message_type() const override;
-  const std::string &get_entity_id() const;
-  const std::string &get_state() const;
+  /// The entity ID and state point into the received message, so they're only valid while it's handled.
+  const StringView &get_entity_id() const;
+  const StringView &get_state() const;
 
  protected:
-  std::string entity_id_;
-  std::string state_;
+  StringView entity_id_{};
+  StringView state_{};
 };
 
 }  // namespace api
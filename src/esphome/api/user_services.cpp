@@ -9,41 +9,90 @@ ESPHOME_NAMESPACE_BEGIN
 
 namespace api {
 
-template<> bool ExecuteServiceArgument::get_value<bool>() { return this->value_bool_; }
-template<> int ExecuteServiceArgument::get_value<int>() { return this->value_int_; }
-template<> float ExecuteServiceArgument::get_value<float>() { return this->value_float_; }
-template<> std::string ExecuteServiceArgument::get_value<std::string>() { return this->value_string_; }
-
-APIMessageType ExecuteServiceArgument::message_type() const { return APIMessageType::EXECUTE_SERVICE_REQUEST; }
-bool ExecuteServiceArgument::decode_varint(uint32_t field_id, uint32_t value) {
-  switch (field_id) {
-    case 1:  // bool bool_ = 1;
-      this->value_bool_ = value;
-      return true;
-    case 2:  // int32 int_ = 2;
-      this->value_int_ = value;
-      return true;
-    default:
-      return false;
-  }
+bool decode_service_arg_varint(bool *value, uint32_t field_id, uint32_t field) {
+  if (field_id != 1)  // bool bool_ = 1;
+    return false;
+  *value = field;
+  return true;
 }
-bool ExecuteServiceArgument::decode_32bit(uint32_t field_id, uint32_t value) {
-  switch (field_id) {
-    case 3:  // float float_ = 3;
-      this->value_float_ = as_float(value);
-      return true;
-    default:
+bool decode_service_arg_varint(int *value, uint32_t field_id, uint32_t field) {
+  if (field_id != 2)  // int32 int_ = 2;
+    return false;
+  *value = field;
+  return true;
+}
+bool decode_service_arg_varint(std::vector<bool> *value, uint32_t field_id, uint32_t field) {
+  if (field_id != 6)  // repeated bool bool_array = 6;
+    return false;
+  value->push_back(field);
+  return true;
+}
+bool decode_service_arg_varint(std::vector<int> *value, uint32_t field_id, uint32_t field) {
+  if (field_id != 7)  // repeated int32 int_array = 7;
+    return false;
+  value->push_back(field);
+  return true;
+}
+bool decode_service_arg_32bit(float *value, uint32_t field_id, uint32_t field) {
+  if (field_id != 3)  // float float_ = 3;
+    return false;
+  *value = as_float(field);
+  return true;
+}
+bool decode_service_arg_32bit(std::vector<float> *value, uint32_t field_id, uint32_t field) {
+  if (field_id != 8)  // repeated float float_array = 8;
+    return false;
+  value->push_back(as_float(field));
+  return true;
+}
+bool decode_service_arg_length_delimited(std::string *value, uint32_t field_id, const uint8_t *field, size_t len) {
+  if (field_id != 4)  // string string_ = 4;
+    return false;
+  value->assign(reinterpret_cast<const char *>(field), len);
+  return true;
+}
+bool decode_service_arg_length_delimited(std::vector<std::string> *value, uint32_t field_id, const uint8_t *field,
+                                         size_t len) {
+  if (field_id != 9)  // repeated string string_array = 9;
+    return false;
+  value->emplace_back(reinterpret_cast<const char *>(field), len);
+  return true;
+}
+/// Decode the elements of a packed repeated varint field.
+template<typename T> static bool decode_packed_varints(std::vector<T> *value, const uint8_t *field, size_t len) {
+  size_t i = 0;
+  while (i < len) {
+    uint32_t consumed;
+    auto res = proto_decode_varuint32(&field[i], len - i, &consumed);
+    if (!res.has_value())
       return false;
+    value->push_back(*res);
+    i += consumed;
   }
+  return true;
 }
-bool ExecuteServiceArgument::decode_length_delimited(uint32_t field_id, const uint8_t *value, size_t len) {
-  switch (field_id) {
-    case 4:  // string string_ = 4;
-      this->value_string_ = as_string(value, len);
-      return true;
-    default:
-      return false;
+bool decode_service_arg_length_delimited(std::vector<bool> *value, uint32_t field_id, const uint8_t *field,
+                                         size_t len) {
+  // packed repeated bool bool_array = 6;
+  return field_id == 6 && decode_packed_varints(value, field, len);
+}
+bool decode_service_arg_length_delimited(std::vector<int> *value, uint32_t field_id, const uint8_t *field,
+                                         size_t len) {
+  // packed repeated int32 int_array = 7;
+  return field_id == 7 && decode_packed_varints(value, field, len);
+}
+bool decode_service_arg_length_delimited(std::vector<float> *value, uint32_t field_id, const uint8_t *field,
+                                         size_t len) {
+  // packed repeated float float_array = 8;
+  if (field_id != 8 || len % 4 != 0)
+    return false;
+  value->reserve(value->size() + len / 4);
+  for (size_t i = 0; i < len; i += 4) {
+    uint32_t val = (uint32_t(field[i]) << 0) | (uint32_t(field[i + 1]) << 8) | (uint32_t(field[i + 2]) << 16) |
+                   (uint32_t(field[i + 3]) << 24);
+    value->push_back(as_float(val));
   }
+  return true;
 }
 
 bool ExecuteServiceRequest::decode_32bit(uint32_t field_id, uint32_t value) {
@@ -58,9 +107,13 @@ bool ExecuteServiceRequest::decode_32bit(uint32_t field_id, uint32_t value) {
 bool ExecuteServiceRequest::decode_length_delimited(uint32_t field_id, const uint8_t *value, size_t len) {
   switch (field_id) {
     case 2: {  // repeated ExecuteServiceArgument args = 2;
-      ExecuteServiceArgument arg;
-      arg.decode(value, len);
-      this->args_.push_back(arg);
+      if (this->arg_count_ == MAX_SERVICE_ARGS) {
+        this->too_many_args_ = true;
+        return false;
+      }
+      this->args_[this->arg_count_] = value;
+      this->args_length_[this->arg_count_] = len;
+      this->arg_count_++;
       return true;
     }
     default:
@@ -68,7 +121,7 @@ bool ExecuteServiceRequest::decode_length_delimited(uint32_t field_id, const uin
   }
 }
 APIMessageType ExecuteServiceRequest::message_type() const { return APIMessageType::EXECUTE_SERVICE_REQUEST; }
-const std::vector<ExecuteServiceArgument> &ExecuteServiceRequest::get_args() const { return this->args_; }
+size_t ExecuteServiceRequest::get_arg_count() const { return this->too_many_args_ ? 0 : this->arg_count_; }
 uint32_t ExecuteServiceRequest::get_key() const { return this->key_; }
 
 ServiceTypeArgument::ServiceTypeArgument(const std::string &name, ServiceArgType type) : name_(name), type_(type) {}
@@ -6,7 +6,10 @@
 #ifdef USE_API
 
 #include "esphome/component.h"
+#include "esphome/automation.h"
 #include "esphome/api/api_message.h"
+#include "esphome/log.h"
+#include <tuple>
 
 ESPHOME_NAMESPACE_BEGIN
 
@@ -17,8 +20,15 @@ enum ServiceArgType {
   SERVICE_ARG_TYPE_INT = 1,
   SERVICE_ARG_TYPE_FLOAT = 2,
   SERVICE_ARG_TYPE_STRING = 3,
+  SERVICE_ARG_TYPE_BOOL_ARRAY = 4,
+  SERVICE_ARG_TYPE_INT_ARRAY = 5,
+  SERVICE_ARG_TYPE_FLOAT_ARRAY = 6,
+  SERVICE_ARG_TYPE_STRING_ARRAY = 7,
 };
 
+/// The maximum number of arguments of a user service.
+static const size_t MAX_SERVICE_ARGS = 16;
+
 class ServiceTypeArgument {
  public:
   ServiceTypeArgument(const std::string &name, ServiceArgType type);
@@ -30,22 +40,64 @@ class ServiceTypeArgument {
   ServiceArgType type_;
 };
 
-class ExecuteServiceArgument : public APIMessage {
+/** Decode the fields of an ExecuteServiceArgument into the C++ type of the argument.
+ *
+ * Each returns false if the field doesn't belong to the type, array elements are appended.
+ */
+bool decode_service_arg_varint(bool *value, uint32_t field_id, uint32_t field);
+bool decode_service_arg_varint(int *value, uint32_t field_id, uint32_t field);
+bool decode_service_arg_varint(std::vector<bool> *value, uint32_t field_id, uint32_t field);
+bool decode_service_arg_varint(std::vector<int> *value, uint32_t field_id, uint32_t field);
+template<typename T> bool decode_service_arg_varint(T *value, uint32_t field_id, uint32_t field) { return false; }
+bool decode_service_arg_32bit(float *value, uint32_t field_id, uint32_t field);
+bool decode_service_arg_32bit(std::vector<float> *value, uint32_t field_id, uint32_t field);
+template<typename T> bool decode_service_arg_32bit(T *value, uint32_t field_id, uint32_t field) { return false; }
+bool decode_service_arg_length_delimited(std::string *value, uint32_t field_id, const uint8_t *field, size_t len);
+bool decode_service_arg_length_delimited(std::vector<std::string> *value, uint32_t field_id, const uint8_t *field,
+                                         size_t len);
+bool decode_service_arg_length_delimited(std::vector<bool> *value, uint32_t field_id, const uint8_t *field,
+                                         size_t len);
+bool decode_service_arg_length_delimited(std::vector<int> *value, uint32_t field_id, const uint8_t *field,
+                                         size_t len);
+bool decode_service_arg_length_delimited(std::vector<float> *value, uint32_t field_id, const uint8_t *field,
+                                         size_t len);
+template<typename T>
+bool decode_service_arg_length_delimited(T *value, uint32_t field_id, const uint8_t *field, size_t len) {
+  return false;
+}
+
+/** An ExecuteServiceArgument message decoded straight into a value of the declared argument type.
+ *
+ * A field for another type (for example a string for an int argument) marks the argument invalid.
+ */
+template<typename T> class ExecuteServiceArgument : public APIMessage {
  public:
-  APIMessageType message_type() const override;
-  template<typename T> T get_value();
+  explicit ExecuteServiceArgument(T *value) : value_(value) {}
+  APIMessageType message_type() const override { return APIMessageType::EXECUTE_SERVICE_REQUEST; }
 
-  bool decode_varint(uint32_t field_id, uint32_t value) override;
-  bool decode_length_delimited(uint32_t field_id, const uint8_t *value, size_t len) override;
-  bool decode_32bit(uint32_t field_id, uint32_t value) override;
+  bool decode_varint(uint32_t field_id, uint32_t value) override {
+    return this->check_(decode_service_arg_varint(this->value_, field_id, value));
+  }
+  bool decode_length_delimited(uint32_t field_id, const uint8_t *value, size_t len) override {
+    return this->check_(decode_service_arg_length_delimited(this->value_, field_id, value, len));
+  }
+  bool decode_32bit(uint32_t field_id, uint32_t value) override {
+    return this->check_(decode_service_arg_32bit(this->value_, field_id, value));
+  }
+
+  bool is_valid() const { return this->valid_; }
 
  protected:
-  bool value_bool_{false};
-  int value_int_{0};
-  float value_float_{0.0f};
-  std::string value_string_{};
+  bool check_(bool decoded) {
+    this->valid_ = this->valid_ && decoded;
+    return decoded;
+  }
+
+  T *value_;
+  bool valid_{true};
 };
 
+/// The arguments are only located when the request is decoded, UserService decodes them into their types.
 class ExecuteServiceRequest : public APIMessage {
  public:
   bool decode_length_delimited(uint32_t field_id, const uint8_t *value, size_t len) override;
@@ -53,11 +105,23 @@ class ExecuteServiceRequest : public APIMessage {
   APIMessageType message_type() const override;
 
   uint32_t get_key() const;
-  const std::vector<ExecuteServiceArgument> &get_args() const;
+  /// The number of arguments, 0 if there were too many (more than MAX_SERVICE_ARGS).
+  size_t get_arg_count() const;
+
+  /// Decode the argument at index into value, returns false if it doesn't have the type of value.
+  template<typename T> bool decode_arg(size_t index, T *value) const {
+    ExecuteServiceArgument<T> arg(value);
+    arg.decode(this->args_[index], this->args_length_[index]);
+    return arg.is_valid();
+  }
 
  protected:
   uint32_t key_;
-  std::vector<ExecuteServiceArgument> args_;
+  /// The encoded arguments, pointing into the received message.
+  const uint8_t *args_[MAX_SERVICE_ARGS];
+  size_t args_length_[MAX_SERVICE_ARGS];
+  size_t arg_count_{0};
+  bool too_many_args_{false};
 };
 
 class UserServiceDescriptor {
@@ -76,7 +140,7 @@ template<typename... Ts> class UserService : public UserServiceDescriptor, publi
   bool execute_service(const ExecuteServiceRequest &req) override;
 
  protected:
-  template<int... S> void execute_(std::vector<ExecuteServiceArgument> args, seq<S...>);
+  template<int... S> bool execute_(const ExecuteServiceRequest &req, seq<S...>);
 
   std::string name_;
   uint32_t key_{0};
@@ -85,8 +149,17 @@ template<typename... Ts> class UserService : public UserServiceDescriptor, publi
 
 template<typename... Ts>
 template<int... S>
-void UserService<Ts...>::execute_(std::vector<ExecuteServiceArgument> args, seq<S...>) {
-  this->trigger((args[S].get_value<Ts>())...);
+bool UserService<Ts...>::execute_(const ExecuteServiceRequest &req, seq<S...>) {
+  std::tuple<Ts...> args;
+  bool valid[] = {true, req.decode_arg(S, &std::get<S>(args))...};
+  for (bool arg_valid : valid) {
+    if (!arg_valid) {
+      ESP_LOGW("api.service", "Service '%s' called with wrong argument types!", this->name_.c_str());
+      return false;
+    }
+  }
+  this->trigger(std::get<S>(args)...);
+  return true;
 }
 template<typename... Ts> void UserService<Ts...>::encode_list_service_response(APIBuffer &buffer) {
   // string name = 1;
@@ -108,12 +181,11 @@ template<typename... Ts> bool UserService<Ts...>::execute_service(const ExecuteS
   if (req.get_key() != this->key_)
     return false;
 
-  if (req.get_args().size() != this->args_.size()) {
+  if (req.get_arg_count() != this->args_.size()) {
     return false;
   }
 
-  this->execute_(req.get_args(), typename gens<sizeof...(Ts)>::type());
-  return true;
+  return this->execute_(req, typename gens<sizeof...(Ts)>::type());
 }
 template<typename... Ts>
 UserService<Ts...>::UserService(const std::string &name, const std::array<ServiceTypeArgument, sizeof...(Ts)> &args)
@@ -121,11 +193,6 @@ UserService<Ts...>::UserService(const std::string &name, const std::array<Servic
   this->key_ = fnv1_hash(this->name_);
 }
 
-template<> bool ExecuteServiceArgument::get_value<bool>();
-template<> int ExecuteServiceArgument::get_value<int>();
-template<> float ExecuteServiceArgument::get_value<float>();
-template<> std::string ExecuteServiceArgument::get_value<std::string>();
-
 }  // namespace api
 
 ESPHOME_NAMESPACE_END
@@ -153,6 +153,26 @@ optional<uint32_t> proto_decode_varuint32(const uint8_t *buf, size_t len, uint32
 std::string as_string(const uint8_t *value, size_t len) {
   return std::string(reinterpret_cast<const char *>(value), len);
 }
+StringView as_string_view(const uint8_t *value, size_t len) {
+  return StringView{.data = reinterpret_cast<const char *>(value), .length = len};
+}
+std::string StringView::str() const { return std::string(this->data, this->length); }
+bool StringView::operator==(const std::string &other) const {
+  return other.size() == this->length && memcmp(other.data(), this->data, this->length) == 0;
+}
+optional<float> StringView::parse_float() const {
+  // the message isn't null terminated, copy to the stack for strtof
+  char buffer[32];
+  if (this->length == 0 || this->length >= sizeof(buffer))
+    return {};
+  memcpy(buffer, this->data, this->length);
+  buffer[this->length] = '\0';
+  char *end;
+  float value = ::strtof(buffer, &end);
+  if (end != buffer + this->length)
+    return {};
+  return value;
+}
 
 int32_t as_sint32(uint32_t val) {
   if (val & 1)
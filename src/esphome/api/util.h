@@ -44,7 +44,19 @@ class APIBuffer {
 
 optional<uint32_t> proto_decode_varuint32(const uint8_t *buf, size_t len, uint32_t *consumed = nullptr);
 
+/// A string inside a received message, without copying it. Only valid while the message is being handled.
+struct StringView {
+  const char *data;
+  size_t length;
+
+  std::string str() const;
+  bool operator==(const std::string &other) const;
+  /// Parse the string as a float, without the trailing garbage strtof() would accept.
+  optional<float> parse_float() const;
+};
+
 std::string as_string(const uint8_t *value, size_t len);
+StringView as_string_view(const uint8_t *value, size_t len);
 int32_t as_sint32(uint32_t val);
 float as_float(uint32_t val);
 
@@ -143,6 +143,8 @@ void HOT Application::loop() {
     this->dump_config();
     this->dump_config_scheduled_ = false;
   }
+
+  global_preferences.loop();
 }
 
 WiFiComponent *Application::init_wifi(const std::string &ssid, const std::string &password) {
@@ -164,6 +166,8 @@ EthernetComponent *Application::init_ethernet() {
 void Application::set_name(const std::string &name) {
   this->name_ = to_lowercase_underscore(name);
   global_preferences.begin(name);
+  // write the deferred preferences before rebooting, going to deep sleep and OTA updates
+  add_safe_shutdown_hook([](const char *cause) { global_preferences.flush(); });
 }
 
 void Application::set_compilation_datetime(const char *str) { this->compilation_time_ = str; }
@@ -384,6 +388,9 @@ switch_::GPIOSwitch *Application::make_gpio_switch(const std::string &friendly_n
   this->register_switch(gpio_switch);
   return gpio_switch;
 }
+switch_::GPIOSwitchGroup *Application::make_gpio_switch_group(const std::vector<switch_::GPIOSwitch *> &switches) {
+  return this->register_component(new GPIOSwitchGroup(switches));
+}
 #endif
 
 const std::string &Application::get_name() const { return this->name_; }
@@ -963,12 +970,25 @@ display::WaveshareEPaper *Application::make_waveshare_epaper_type_b(SPIComponent
 }
 #endif
 
+#ifdef USE_SPI_TFT
+display::ST7735 *Application::make_st7735(SPIComponent *parent, const GPIOOutputPin &cs, const GPIOOutputPin &dc_pin,
+                                          uint32_t update_interval) {
+  return this->register_component(new display::ST7735(parent, cs.copy(), dc_pin.copy(), update_interval));
+}
+
+display::ILI9341 *Application::make_ili9341(SPIComponent *parent, const GPIOOutputPin &cs,
+                                            const GPIOOutputPin &dc_pin, uint32_t update_interval) {
+  return this->register_component(new display::ILI9341(parent, cs.copy(), dc_pin.copy(), update_interval));
+}
+#endif
+
 #ifdef USE_DISPLAY
 display::Font *Application::make_font(std::vector<display::Glyph> &&glyphs, int baseline, int bottom) {
   return new display::Font(std::move(glyphs), baseline, bottom);
 }
-display::Image *Application::make_image(const uint8_t *data_start, int width, int height) {
-  return new display::Image(data_start, width, height);
+display::Image *Application::make_image(const uint8_t *data_start, int width, int height,
+                                        display::ImageType type) {
+  return new display::Image(data_start, width, height, type);
 }
 #endif
 
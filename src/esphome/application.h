@@ -52,6 +52,7 @@
 #include "esphome/display/lcd_display.h"
 #include "esphome/display/max7219.h"
 #include "esphome/display/nextion.h"
+#include "esphome/display/spi_tft.h"
 #include "esphome/display/ssd1306.h"
 #include "esphome/display/waveshare_epaper.h"
 #include "esphome/fan/basic_fan_component.h"
@@ -294,7 +295,8 @@ class Application {
 #ifdef USE_DISPLAY
   display::Font *make_font(std::vector<display::Glyph> &&glyphs, int baseline, int bottom);
 
-  display::Image *make_image(const uint8_t *data_start, int width, int height);
+  display::Image *make_image(const uint8_t *data_start, int width, int height,
+                             display::ImageType type = display::IMAGE_TYPE_BINARY);
 #endif
 
 #ifdef USE_MAX7219
@@ -333,6 +335,14 @@ class Application {
                                                          uint32_t update_interval = 10000);
 #endif
 
+#ifdef USE_SPI_TFT
+  display::ST7735 *make_st7735(SPIComponent *parent, const GPIOOutputPin &cs, const GPIOOutputPin &dc_pin,
+                               uint32_t update_interval = 1000);
+
+  display::ILI9341 *make_ili9341(SPIComponent *parent, const GPIOOutputPin &cs, const GPIOOutputPin &dc_pin,
+                                 uint32_t update_interval = 1000);
+#endif
+
 #ifdef USE_NEXTION
   display::Nextion *make_nextion(UARTComponent *parent, uint32_t update_interval = 5000);
 #endif
@@ -1026,6 +1036,12 @@ class Application {
    * @param friendly_name The friendly name advertised to Home Assistant for this switch-
    */
   switch_::GPIOSwitch *make_gpio_switch(const std::string &friendly_name, const GPIOOutputPin &pin);
+
+  /** Create a group of GPIO switches that are interlocked and switched together.
+   *
+   * @param switches The GPIO switches of this group, at most 32.
+   */
+  switch_::GPIOSwitchGroup *make_gpio_switch_group(const std::vector<switch_::GPIOSwitch *> &switches);
 #endif
 
 #ifdef USE_RESTART_SWITCH
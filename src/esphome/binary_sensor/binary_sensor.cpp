@@ -11,9 +11,6 @@ namespace binary_sensor {
 
 static const char *TAG = "binary_sensor";
 
-void BinarySensor::add_on_state_callback(std::function<void(bool)> &&callback) {
-  this->state_callback_.add(std::move(callback));
-}
 
 void BinarySensor::publish_state(bool state) {
   if (!this->publish_dedup_.next(state))
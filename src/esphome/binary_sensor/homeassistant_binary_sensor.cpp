@@ -13,12 +13,17 @@ namespace binary_sensor {
 static const char *TAG = "binary_sensor.homeassistant";
 
 void HomeassistantBinarySensor::setup() {
-  api::global_api_server->subscribe_home_assistant_state(this->entity_id_, [this](std::string state) {
-    auto val = parse_on_off(state.c_str());
+  api::global_api_server->subscribe_home_assistant_state_view(this->entity_id_, [this](const api::StringView &state) {
+    // parse_on_off needs a null terminated string, states like "on"/"off"/"unavailable" fit on the stack
+    char buffer[16];
+    const size_t length = std::min(state.length, sizeof(buffer) - 1);
+    memcpy(buffer, state.data, length);
+    buffer[length] = '\0';
+    auto val = length == state.length ? parse_on_off(buffer) : PARSE_NONE;
     switch (val) {
       case PARSE_NONE:
       case PARSE_TOGGLE:
-        ESP_LOGW(TAG, "Can't convert '%s' to binary state!", state.c_str());
+        ESP_LOGW(TAG, "Can't convert '%.*s' to binary state!", int(state.length), state.data);
         break;
       case PARSE_ON:
         ESP_LOGD(TAG, "'%s': Got state ON", this->entity_id_.c_str());
@@ -12,59 +12,88 @@ static const char *TAG = "binary_sensor.mpr121";
 
 MPR121Channel::MPR121Channel(const std::string &name, int channel_num) : BinarySensor(name) { channel_ = channel_num; }
 
-void MPR121Channel::process(const uint16_t *data, const uint16_t *last_data) {
-  if ((*data & (1 << this->channel_)) && !(*last_data & (1 << this->channel_))) {
-    this->publish_state(true);
-  }
-  if (!(*data & (1 << this->channel_)) && (*last_data & (1 << this->channel_))) {
-    this->publish_state(false);
-  }
-}
+void MPR121Channel::process(uint16_t data) { this->publish_state(data & (1 << this->channel_)); }
+int MPR121Channel::get_channel() const { return this->channel_; }
 
 MPR121Component::MPR121Component(I2CComponent *parent, uint8_t address) : I2CDevice(parent, address) {}
 
 void MPR121Component::setup() {
   ESP_LOGCONFIG(TAG, "Setting up MPR121...");
+  if (this->irq_pin_ != nullptr)
+    this->irq_pin_->setup();
+
   // soft reset device
   this->write_byte(MPR121_SOFTRESET, 0x63);
-  delay(100);
+  delay(1);
+  uint8_t config2;
+  if (!this->read_byte(MPR121_CONFIG2, &config2)) {
+    this->error_code_ = COMMUNICATION_FAILED;
+    this->mark_failed();
+    return;
+  }
+  // CONFIG2 resets to 0x24, anything else means the reset didn't go through
+  if (config2 != 0x24) {
+    this->error_code_ = WRONG_CHIP_STATE;
+    this->mark_failed();
+    return;
+  }
   if (!this->write_byte(MPR121_ECR, 0x0)) {
     this->error_code_ = COMMUNICATION_FAILED;
     this->mark_failed();
     return;
   }
 
-  // set touch sensitivity for all 12 channels
-  for (uint8_t i = 0; i < 12; i++) {
-    this->write_byte(MPR121_TOUCHTH_0 + 2 * i, 12);
-    this->write_byte(MPR121_RELEASETH_0 + 2 * i, 6);
+  // The MPR121 auto-increments the register address, so the register table is written as three bursts.
+  // set touch sensitivity for all 12 channels (TOUCHTH_0, RELEASETH_0, ..., RELEASETH_11)
+  uint8_t thresholds[MPR121_CHANNELS * 2];
+  for (uint8_t i = 0; i < MPR121_CHANNELS; i++) {
+    thresholds[i * 2] = this->touch_threshold_;
+    thresholds[i * 2 + 1] = this->release_threshold_;
+  }
+  // MHDR to FDLT
+  const uint8_t filter[] = {
+      0x01, 0x01, 0x0E, 0x00,  // rising: MHDR, NHDR, NCLR, FDLR
+      0x01, 0x05, 0x01, 0x00,  // falling: MHDF, NHDF, NCLF, FDLF
+      0x00, 0x00, 0x00,        // touched: NHDT, NCLT, FDLT
+  };
+  // DEBOUNCE, CONFIG1 (default, 16uA charge current), CONFIG2 (0.5uS encoding, 1ms period)
+  const uint8_t config[] = {0x00, 0x10, 0x20};
+  if (!this->write_bytes(MPR121_TOUCHTH_0, thresholds, sizeof(thresholds)) ||
+      !this->write_bytes(MPR121_MHDR, filter, sizeof(filter)) ||
+      !this->write_bytes(MPR121_DEBOUNCE, config, sizeof(config)) ||
+      // start with first 5 bits of baseline tracking
+      !this->write_byte(MPR121_ECR, 0x8F)) {
+    this->error_code_ = COMMUNICATION_FAILED;
+    this->mark_failed();
+    return;
+  }
+
+  if (this->diagnostics_interval_ != 0) {
+    this->set_interval("diagnostics", this->diagnostics_interval_, [this]() {
+      if (!this->read_diagnostics_()) {
+        this->status_set_warning();
+        return;
+      }
+      for (uint8_t i = 0; i < MPR121_CHANNELS; i++) {
+        if (this->channels_[i] == nullptr)
+          continue;
+        uint16_t baseline = this->get_baseline_data(i);
+        ESP_LOGD(TAG, "Channel %u: filtered=%u baseline=%u delta=%d", i, this->filtered_data_[i], baseline,
+                 int(baseline) - int(this->filtered_data_[i]));
+      }
+    });
   }
-  this->write_byte(MPR121_MHDR, 0x01);
-  this->write_byte(MPR121_NHDR, 0x01);
-  this->write_byte(MPR121_NCLR, 0x0E);
-  this->write_byte(MPR121_FDLR, 0x00);
-
-  this->write_byte(MPR121_MHDF, 0x01);
-  this->write_byte(MPR121_NHDF, 0x05);
-  this->write_byte(MPR121_NCLF, 0x01);
-  this->write_byte(MPR121_FDLF, 0x00);
-
-  this->write_byte(MPR121_NHDT, 0x00);
-  this->write_byte(MPR121_NCLT, 0x00);
-  this->write_byte(MPR121_FDLT, 0x00);
-
-  this->write_byte(MPR121_DEBOUNCE, 0);
-  // default, 16uA charge current
-  this->write_byte(MPR121_CONFIG1, 0x10);
-  // 0.5uS encoding, 1ms period
-  this->write_byte(MPR121_CONFIG2, 0x20);
-  // start with first 5 bits of baseline tracking
-  this->write_byte(MPR121_ECR, 0x8F);
 }
 
 void MPR121Component::dump_config() {
   ESP_LOGCONFIG(TAG, "MPR121:");
   LOG_I2C_DEVICE(this);
+  LOG_PIN("  IRQ Pin: ", this->irq_pin_);
+  ESP_LOGCONFIG(TAG, "  Touch Threshold: %u", this->touch_threshold_);
+  ESP_LOGCONFIG(TAG, "  Release Threshold: %u", this->release_threshold_);
+  if (this->diagnostics_interval_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Diagnostics Interval: %u ms", this->diagnostics_interval_);
+  }
   switch (this->error_code_) {
     case COMMUNICATION_FAILED:
       ESP_LOGE(TAG, "Communication with MPR121 failed!");
@@ -81,33 +110,72 @@ void MPR121Component::dump_config() {
 float MPR121Component::get_setup_priority() const { return setup_priority::HARDWARE_LATE; }
 
 MPR121Channel *MPR121Component::add_channel(binary_sensor::MPR121Channel *channel) {
-  this->channels_.push_back(channel);
+  if (channel->get_channel() < 0 || channel->get_channel() >= MPR121_CHANNELS) {
+    ESP_LOGE(TAG, "Channel %d of '%s' is out of range, the MPR121 only has %u channels!", channel->get_channel(),
+             channel->get_name().c_str(), MPR121_CHANNELS);
+    return channel;
+  }
+  this->channels_[channel->get_channel()] = channel;
   return channel;
 }
-
-void MPR121Component::process_(uint16_t *data, uint16_t *last_data) {
-  for (auto *channel : this->channels_) {
-    channel->process(data, last_data);
-  }
+void MPR121Component::set_irq_pin(GPIOInputPin *irq_pin) { this->irq_pin_ = irq_pin; }
+void MPR121Component::set_touch_threshold(uint8_t touch_threshold) { this->touch_threshold_ = touch_threshold; }
+void MPR121Component::set_release_threshold(uint8_t release_threshold) {
+  this->release_threshold_ = release_threshold;
+}
+void MPR121Component::set_diagnostics_interval(uint32_t diagnostics_interval) {
+  this->diagnostics_interval_ = diagnostics_interval;
+}
+uint16_t MPR121Component::get_filtered_data(uint8_t channel) const { return this->filtered_data_[channel]; }
+uint16_t MPR121Component::get_baseline_data(uint8_t channel) const {
+  // Baseline registers only store the upper 8 of 10 bits
+  return uint16_t(this->baseline_data_[channel]) << 2;
 }
 
-uint16_t MPR121Component::read_mpr121_channels_() {
+bool MPR121Component::read_mpr121_channels_(uint16_t *touched) {
   uint16_t val = 0;
-  this->read_byte_16(MPR121_TOUCHSTATUS_L, &val);
+  if (!this->read_byte_16(MPR121_TOUCHSTATUS_L, &val))
+    return false;
   uint8_t lsb = val >> 8;
   uint8_t msb = val;
   val = ((uint16_t) msb) << 8;
   val |= lsb;
-  return val;
+  // upper bits are over current flag and proximity electrode
+  *touched = val & ((1 << MPR121_CHANNELS) - 1);
+  return true;
+}
+
+bool MPR121Component::read_diagnostics_() {
+  uint8_t filtered[MPR121_CHANNELS * 2];
+  if (!this->read_bytes(MPR121_FILTDATA_0L, filtered, sizeof(filtered)))
+    return false;
+  if (!this->read_bytes(MPR121_BASELINE_0, this->baseline_data_, sizeof(this->baseline_data_)))
+    return false;
+  for (uint8_t i = 0; i < MPR121_CHANNELS; i++)
+    this->filtered_data_[i] = (uint16_t(filtered[i * 2 + 1] & 0x03) << 8) | filtered[i * 2];
+  return true;
 }
 
 void MPR121Component::loop() {
-  this->currtouched_ = this->read_mpr121_channels_();
-  if (this->currtouched_ != this->lasttouched_) {
-    this->process_(&currtouched_, &lasttouched_);
+  // The IRQ line is asserted on every touch status change and cleared by reading the status registers
+  if (this->irq_pin_ != nullptr && !this->irq_pin_->digital_read())
+    return;
+
+  uint16_t touched;
+  if (!this->read_mpr121_channels_(&touched)) {
+    this->status_set_warning();
+    return;
+  }
+  this->status_clear_warning();
+
+  uint16_t changed = touched ^ this->lasttouched_;
+  this->lasttouched_ = touched;
+  while (changed != 0) {
+    uint8_t i = __builtin_ctz(changed);
+    changed &= changed - 1;
+    if (this->channels_[i] != nullptr)
+      this->channels_[i]->process(touched);
   }
-  // reset touchsensor state
-  this->lasttouched_ = this->currtouched_;
 }
 
 }  // namespace binary_sensor
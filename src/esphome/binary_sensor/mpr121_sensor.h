@@ -51,10 +51,13 @@ enum {
   MPR121_SOFTRESET = 0x80,
 };
 
+static const uint8_t MPR121_CHANNELS = 12;
+
 class MPR121Channel : public binary_sensor::BinarySensor {
  public:
   MPR121Channel(const std::string &name, int channel_num = 0);
-  void process(const uint16_t *data, const uint16_t *last_data);
+  void process(uint16_t data);
+  int get_channel() const;
 
  protected:
   int channel_ = 0;
@@ -64,22 +67,49 @@ class MPR121Component : public Component, public I2CDevice {
  public:
   MPR121Component(I2CComponent *parent, uint8_t address = 0x5A);
   binary_sensor::MPR121Channel *add_channel(binary_sensor::MPR121Channel *channel);
+  /** Set the (optional) IRQ pin of the MPR121.
+   *
+   * The touch status registers are then only read when the MPR121 signals a change instead of every loop.
+   * The IRQ line is active-low and open-drain, so this pin should usually be INPUT_PULLUP and inverted.
+   */
+  void set_irq_pin(GPIOInputPin *irq_pin);
+  /// Set the touch threshold applied to all channels (0-255, default 12).
+  void set_touch_threshold(uint8_t touch_threshold);
+  /// Set the release threshold applied to all channels (0-255, default 6).
+  void set_release_threshold(uint8_t release_threshold);
+  /** Periodically read the filtered and baseline data of all electrodes, 0 to disable (the default).
+   *
+   * The values are logged and can be accessed with get_filtered_data()/get_baseline_data(), which is
+   * useful to find good touch/release thresholds for a specific electrode setup.
+   */
+  void set_diagnostics_interval(uint32_t diagnostics_interval);
   void setup() override;
   void dump_config() override;
   float get_setup_priority() const override;
   void loop() override;
 
+  /// Get the 10-bit filtered electrode data of the given channel from the last diagnostics read.
+  uint16_t get_filtered_data(uint8_t channel) const;
+  /// Get the baseline value of the given channel (10-bit scale) from the last diagnostics read.
+  uint16_t get_baseline_data(uint8_t channel) const;
+
  protected:
-  std::vector<MPR121Channel *> channels_{};
+  bool read_diagnostics_();
+
+  MPR121Channel *channels_[MPR121_CHANNELS]{};
+  GPIOInputPin *irq_pin_{nullptr};
+  uint8_t touch_threshold_{12};
+  uint8_t release_threshold_{6};
+  uint32_t diagnostics_interval_{0};
+  uint16_t filtered_data_[MPR121_CHANNELS]{};
+  uint8_t baseline_data_[MPR121_CHANNELS]{};
   uint16_t lasttouched_ = 0;
-  uint16_t currtouched_ = 0;
   enum ErrorCode {
     NONE = 0,
     COMMUNICATION_FAILED,
     WRONG_CHIP_STATE,
   } error_code_{NONE};
-  void process_(uint16_t *data, uint16_t *last_data);
-  uint16_t read_mpr121_channels_();
+  bool read_mpr121_channels_(uint16_t *touched);
 };
 
 }  // namespace binary_sensor
@@ -30,6 +30,8 @@ void format_uid(char *buf, const uint8_t *uid, uint8_t uid_length) {
 void PN532Component::setup() {
   ESP_LOGCONFIG(TAG, "Setting up PN532...");
   this->spi_setup();
+  if (this->irq_pin_ != nullptr)
+    this->irq_pin_->setup();
 
   // Wake the chip up from power down
   // 1. Enable the SS line for at least 2ms
@@ -95,26 +97,57 @@ void PN532Component::setup() {
 }
 
 void PN532Component::update() {
-  bool success = this->pn532_write_command_check_ack_({
+  if (this->state_ == STATE_WAIT_ACK) {
+    ESP_LOGW(TAG, "Previous command is still waiting for an ACK!");
+    this->status_set_warning();
+    return;
+  }
+  // A pending InListPassiveTarget without response simply means no tag was found, start a new one.
+  this->send_command_({
       0x4A,  // INLISTPASSIVETARGET
       0x01,  // max 1 card
       0x00,  // baud rate ISO14443A (106 kbit/s)
   });
-  if (!success) {
-    ESP_LOGW(TAG, "Requesting tag read failed!");
-    this->status_set_warning();
-    return;
-  }
-  this->status_clear_warning();
-  this->requested_read_ = true;
+}
+void PN532Component::send_command_(const std::vector<uint8_t> &data) {
+  this->pn532_write_command_(data);
+  this->state_ = STATE_WAIT_ACK;
+  this->state_start_ = millis();
 }
 void PN532Component::loop() {
-  if (!this->requested_read_ || !this->is_ready_())
+  if (this->state_ == STATE_IDLE || !this->is_ready_()) {
+    if (this->state_ == STATE_WAIT_ACK && millis() - this->state_start_ > 100) {
+      ESP_LOGW(TAG, "Timed out waiting for ACK from PN532!");
+      this->status_set_warning();
+      this->state_ = STATE_IDLE;
+    }
     return;
+  }
 
-  auto read = this->pn532_read_data_();
-  this->requested_read_ = false;
-
+  switch (this->state_) {
+    case STATE_WAIT_ACK:
+      if (!this->read_ack_()) {
+        ESP_LOGW(TAG, "Requesting tag read failed!");
+        this->status_set_warning();
+        this->state_ = STATE_IDLE;
+        return;
+      }
+      this->status_clear_warning();
+      this->state_ = STATE_WAIT_RESPONSE;
+      this->state_start_ = millis();
+      break;
+    case STATE_WAIT_RESPONSE: {
+      auto read = this->pn532_read_data_();
+      this->state_ = STATE_IDLE;
+      this->process_response_(read);
+      break;
+    }
+    case STATE_IDLE:
+    default:
+      break;
+  }
+}
+void PN532Component::process_response_(const std::vector<uint8_t> &read) {
   if (read.size() <= 2 || read[0] != 0x4B) {
     // Something failed
     return;
@@ -141,8 +174,9 @@ void PN532Component::loop() {
     trigger->process(nfcid, nfcid_length);
 
   // 2. Find a binary sensor
-  for (auto *tag : this->binary_sensors_) {
-    if (tag->process(nfcid, nfcid_length)) {
+  auto range = this->tags_by_uid_hash_.equal_range(fnv1_hash(reinterpret_cast<const char *>(nfcid), nfcid_length));
+  for (auto it = range.first; it != range.second; ++it) {
+    if (it->second->process(nfcid, nfcid_length)) {
       // 2.1 if found, do not dump
       report = false;
     }
@@ -160,6 +194,8 @@ float PN532Component::get_setup_priority() const { return setup_priority::HARDWA
 PN532BinarySensor *PN532Component::make_tag(const std::string &name, const std::vector<uint8_t> &uid) {
   auto *tag = new PN532BinarySensor(name, uid, this->get_update_interval());
   this->binary_sensors_.push_back(tag);
+  uint32_t hash = fnv1_hash(reinterpret_cast<const char *>(uid.data()), uid.size());
+  this->tags_by_uid_hash_.insert(std::make_pair(hash, tag));
   return tag;
 }
 
@@ -168,10 +204,10 @@ PN532Trigger *PN532Component::make_trigger() {
   this->triggers_.push_back(trigger);
   return trigger;
 }
+void PN532Component::set_irq_pin(GPIOInputPin *irq_pin) { this->irq_pin_ = irq_pin; }
 
 void PN532Component::pn532_write_command_(const std::vector<uint8_t> &data) {
   this->enable();
-  delay(2);
   // First byte, communication mode: Write data
   this->write_byte(0x01);
 
@@ -227,7 +263,6 @@ bool PN532Component::pn532_write_command_check_ack_(const std::vector<uint8_t> &
 
 std::vector<uint8_t> PN532Component::pn532_read_data_() {
   this->enable();
-  delay(2);
   // Read data (transmission from the PN532 to the host)
   this->write_byte(0x03);
 
@@ -303,6 +338,9 @@ std::vector<uint8_t> PN532Component::pn532_read_data_() {
   return ret;
 }
 bool PN532Component::is_ready_() {
+  if (this->irq_pin_ != nullptr)
+    return this->irq_pin_->digital_read();
+
   this->enable();
   // First byte, communication mode: Read state
   this->write_byte(0x02);
@@ -320,7 +358,6 @@ bool PN532Component::is_ready_() {
 bool PN532Component::read_ack_() {
   ESP_LOGVV(TAG, "Reading ACK...");
   this->enable();
-  delay(2);
   // "Read data (transmission from the PN532 to the host) "
   this->write_byte(0x03);
 
@@ -367,6 +404,7 @@ void PN532Component::dump_config() {
   }
 
   LOG_PIN("  CS Pin: ", this->cs_);
+  LOG_PIN("  IRQ Pin: ", this->irq_pin_);
   LOG_UPDATE_INTERVAL(this);
 
   for (auto *child : this->binary_sensors_) {
@@ -6,6 +6,7 @@
 #ifdef USE_PN532
 
 #include <vector>
+#include <unordered_map>
 #include "esphome/component.h"
 #include "esphome/binary_sensor/binary_sensor.h"
 #include "esphome/spi_component.h"
@@ -33,9 +34,20 @@ class PN532Component : public PollingComponent, public SPIDevice {
   PN532BinarySensor *make_tag(const std::string &name, const std::vector<uint8_t> &uid);
   PN532Trigger *make_trigger();
 
+  /** Set the (optional) IRQ pin of the PN532.
+   *
+   * If set, readiness is signalled by this pin instead of polling the status byte over SPI. The IRQ line
+   * is active-low, so this pin should be inverted.
+   */
+  void set_irq_pin(GPIOInputPin *irq_pin);
+
  protected:
   bool is_device_msb_first() override;
 
+  /// Write a command and start the non-blocking ACK/response exchange that is advanced by loop().
+  void send_command_(const std::vector<uint8_t> &data);
+  void process_response_(const std::vector<uint8_t> &read);
+
   /// Write the full command given in data to the PN532
   void pn532_write_command_(const std::vector<uint8_t> &data);
   bool pn532_write_command_check_ack_(const std::vector<uint8_t> &data);
@@ -63,8 +75,17 @@ class PN532Component : public PollingComponent, public SPIDevice {
 
   bool read_ack_();
 
-  bool requested_read_{false};
+  /// State of the command currently in flight, loop() only ever advances it by non-blocking steps.
+  enum State {
+    STATE_IDLE = 0,
+    STATE_WAIT_ACK,       ///< Command sent, waiting for the ready flag to read the ACK frame.
+    STATE_WAIT_RESPONSE,  ///< ACK received, waiting for the ready flag to read the response frame.
+  } state_{STATE_IDLE};
+  uint32_t state_start_{0};
+  GPIOInputPin *irq_pin_{nullptr};
   std::vector<PN532BinarySensor *> binary_sensors_;
+  /// Tags indexed by the hash of their UID, PN532BinarySensor::process() resolves collisions.
+  std::unordered_multimap<uint32_t, PN532BinarySensor *> tags_by_uid_hash_;
   std::vector<PN532Trigger *> triggers_;
   enum PN532Error {
     NONE = 0,
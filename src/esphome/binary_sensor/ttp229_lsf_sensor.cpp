@@ -14,6 +14,7 @@ static const char *TAG = "binary_sensor.ttp229";
 TTP229Channel::TTP229Channel(const std::string &name, int channel_num) : BinarySensor(name), channel_(channel_num) {}
 
 void TTP229Channel::process(uint16_t data) { this->publish_state(data & (1 << this->channel_)); }
+int TTP229Channel::get_channel() const { return this->channel_; }
 
 TTP229LSFComponent::TTP229LSFComponent(I2CComponent *parent, uint8_t address) : I2CDevice(parent, address) {}
 
@@ -54,8 +55,15 @@ void TTP229LSFComponent::loop() {
   }
   this->status_clear_warning();
   touched = reverse_bits_16(touched);
+  // Only dispatch to channels whose bit changed, the first read after boot reaches all of them
+  uint16_t changed = this->has_last_touched_ ? touched ^ this->last_touched_ : 0xFFFF;
+  this->last_touched_ = touched;
+  this->has_last_touched_ = true;
+  if (changed == 0)
+    return;
   for (auto *channel : this->channels_) {
-    channel->process(touched);
+    if (changed & (1 << channel->get_channel()))
+      channel->process(touched);
   }
 }
 
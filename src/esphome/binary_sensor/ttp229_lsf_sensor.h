@@ -17,6 +17,7 @@ class TTP229Channel : public binary_sensor::BinarySensor {
  public:
   TTP229Channel(const std::string &name, int channel_num);
   void process(uint16_t data);
+  int get_channel() const;
 
  protected:
   int channel_;
@@ -33,6 +34,8 @@ class TTP229LSFComponent : public Component, public I2CDevice {
 
  protected:
   std::vector<TTP229Channel *> channels_{};
+  uint16_t last_touched_{0};
+  bool has_last_touched_{false};
   enum ErrorCode {
     NONE = 0,
     COMMUNICATION_FAILED,
@@ -143,9 +143,6 @@ ClimateCall &ClimateCall::set_mode(optional<ClimateMode> mode) {
   return *this;
 }
 
-void ClimateDevice::add_on_state_callback(std::function<void()> &&callback) {
-  this->state_callback_.add(std::move(callback));
-}
 
 optional<ClimateDeviceRestoreState> ClimateDevice::restore_state_() {
   this->rtc_ = global_preferences.make_preference<ClimateDeviceRestoreState>(this->get_object_id_hash());
@@ -171,12 +168,47 @@ void ClimateDevice::save_state_() {
     state.away = this->away;
   }
 
-  this->rtc_.save(&state);
+  this->rtc_.save_deferred(&state);
+}
+static bool float_changed(float a, float b) { return !(a == b || (isnan(a) && isnan(b))); }
+uint8_t ClimateDevice::get_state_changes_(const ClimateTraits &traits) {
+  ClimateDeviceRestoreState &last = this->published_state_;
+  uint8_t changed = 0;
+  if (!this->has_published_state_) {
+    changed = CLIMATE_FIELD_ALL;
+  } else {
+    if (this->mode != last.mode)
+      changed |= CLIMATE_FIELD_MODE;
+    if (traits.get_supports_current_temperature() &&
+        float_changed(this->current_temperature, this->published_current_temperature_))
+      changed |= CLIMATE_FIELD_CURRENT_TEMPERATURE;
+    if (traits.get_supports_two_point_target_temperature()) {
+      if (float_changed(this->target_temperature_low, last.target_temperature_low))
+        changed |= CLIMATE_FIELD_TARGET_TEMPERATURE_LOW;
+      if (float_changed(this->target_temperature_high, last.target_temperature_high))
+        changed |= CLIMATE_FIELD_TARGET_TEMPERATURE_HIGH;
+    } else if (float_changed(this->target_temperature, last.target_temperature)) {
+      changed |= CLIMATE_FIELD_TARGET_TEMPERATURE;
+    }
+    if (traits.get_supports_away() && this->away != last.away)
+      changed |= CLIMATE_FIELD_AWAY;
+  }
+
+  last.mode = this->mode;
+  last.away = this->away;
+  last.target_temperature_low = this->target_temperature_low;
+  last.target_temperature_high = this->target_temperature_high;
+  this->published_current_temperature_ = this->current_temperature;
+  this->has_published_state_ = true;
+  return changed;
 }
 void ClimateDevice::publish_state() {
-  ESP_LOGD(TAG, "'%s' - Sending state:", this->name_.c_str());
   auto traits = this->get_traits();
+  uint8_t changed = this->get_state_changes_(traits);
+  if (changed == 0)
+    return;
 
+  ESP_LOGD(TAG, "'%s' - Sending state:", this->name_.c_str());
   ESP_LOGD(TAG, "  Mode: %s", climate_mode_to_string(this->mode));
   if (traits.get_supports_current_temperature()) {
     ESP_LOGD(TAG, "  Current Temperature: %.2f°C", this->current_temperature);
@@ -192,10 +224,13 @@ void ClimateDevice::publish_state() {
   }
 
   // Send state to frontend
+  this->changed_fields_ = changed;
   this->state_callback_.call();
+  this->changed_fields_ = 0;
   // Save state
   this->save_state_();
 }
+uint8_t ClimateDevice::get_changed_fields() const { return this->changed_fields_; }
 uint32_t ClimateDevice::hash_base() { return 3104134496UL; }
 
 ClimateTraits ClimateDevice::get_traits() {
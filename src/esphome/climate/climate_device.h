@@ -18,6 +18,17 @@ namespace climate {
 
 class ClimateDevice;
 
+/// The fields of a climate device state, used to tell the frontends which fields changed with a publish.
+enum ClimateStateField : uint8_t {
+  CLIMATE_FIELD_MODE = 1 << 0,
+  CLIMATE_FIELD_CURRENT_TEMPERATURE = 1 << 1,
+  CLIMATE_FIELD_TARGET_TEMPERATURE = 1 << 2,
+  CLIMATE_FIELD_TARGET_TEMPERATURE_LOW = 1 << 3,
+  CLIMATE_FIELD_TARGET_TEMPERATURE_HIGH = 1 << 4,
+  CLIMATE_FIELD_AWAY = 1 << 5,
+  CLIMATE_FIELD_ALL = 0x3F,
+};
+
 /** This class is used to encode all control actions on a climate device.
  *
  * It is supposed to be used by all code that wishes to control a climate device (mqtt, api, lambda etc).
@@ -154,7 +165,9 @@ class ClimateDevice : public Nameable {
    *
    * @param callback The callback to call.
    */
-  void add_on_state_callback(std::function<void()> &&callback);
+  template<typename F> void add_on_state_callback(F &&callback) {
+    this->state_callback_.add(std::forward<F>(callback));
+  }
 
   /** Make a climate device control call, this is used to control the climate device, see the ClimateCall description
    * for more info.
@@ -165,10 +178,17 @@ class ClimateDevice : public Nameable {
   /** Publish the state of the climate device, to be called from integrations.
    *
    * This will schedule the climate device to publish its state to all listeners and save the current state
-   * to recover memory.
+   * to recover memory. Publishing a state that didn't change since the last publish does nothing, and the
+   * restore state is written deferred (see ESPPreferenceObject::save_deferred()), so quick changes are coalesced.
    */
   void publish_state();
 
+  /** The ClimateStateFields that changed with the last publish_state() call.
+   *
+   * Only valid while the state callbacks run, frontends use this to only send what changed.
+   */
+  uint8_t get_changed_fields() const;
+
   /** Get the traits of this climate device with all overrides applied.
    *
    * Traits are static data that encode the capabilities and static data for a climate device such as supported
@@ -209,13 +229,23 @@ class ClimateDevice : public Nameable {
   optional<ClimateDeviceRestoreState> restore_state_();
   /** Internal method to save the state of the climate device to recover memory. This is automatically
    * called from publish_state()
+   *
+   * The state is saved deferred: it's written once the preferences stopped changing for the flush delay or on
+   * shutdown, and only if it differs from the stored one.
    */
   void save_state_();
+  /// Compare the state to the last published one and return the changed ClimateStateFields.
+  uint8_t get_state_changes_(const ClimateTraits &traits);
 
   uint32_t hash_base() override;
 
   CallbackManager<void()> state_callback_{};
   ESPPreferenceObject rtc_;
+  /// The state that was last published, to find out which fields changed.
+  ClimateDeviceRestoreState published_state_{};
+  float published_current_temperature_{NAN};
+  bool has_published_state_{false};
+  uint8_t changed_fields_{0};
   optional<float> visual_min_temperature_override_{};
   optional<float> visual_max_temperature_override_{};
   optional<float> visual_temperature_step_override_{};
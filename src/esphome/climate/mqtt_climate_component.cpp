@@ -131,40 +131,46 @@ void MQTTClimateComponent::setup() {
     });
   }
 
-  this->device_->add_on_state_callback([this]() { this->publish_state_(); });
+  this->device_->add_on_state_callback([this]() { this->publish_state_(this->device_->get_changed_fields()); });
 }
 MQTTClimateComponent::MQTTClimateComponent(ClimateDevice *device) : device_(device) {}
-bool MQTTClimateComponent::send_initial_state() { return this->publish_state_(); }
+bool MQTTClimateComponent::send_initial_state() { return this->publish_state_(CLIMATE_FIELD_ALL); }
 bool MQTTClimateComponent::is_internal() { return this->device_->is_internal(); }
 std::string MQTTClimateComponent::component_type() const { return "climate"; }
 std::string MQTTClimateComponent::friendly_name() const { return this->device_->get_name(); }
-bool MQTTClimateComponent::publish_state_() {
+bool MQTTClimateComponent::publish_state_(uint8_t fields) {
   auto traits = this->device_->get_traits();
-  // mode
-  const char *mode_s = climate_mode_to_string(this->device_->mode);
   bool success = true;
-  if (!this->publish(this->get_mode_state_topic(), mode_s))
-    success = false;
+  // mode
+  if (fields & CLIMATE_FIELD_MODE) {
+    const char *mode_s = climate_mode_to_string(this->device_->mode);
+    if (!this->publish(this->get_mode_state_topic(), mode_s))
+      success = false;
+  }
   int8_t accuracy = traits.get_temperature_accuracy_decimals();
-  if (traits.get_supports_current_temperature()) {
+  if ((fields & CLIMATE_FIELD_CURRENT_TEMPERATURE) && traits.get_supports_current_temperature()) {
     std::string payload = value_accuracy_to_string(this->device_->current_temperature, accuracy);
     if (!this->publish(this->get_current_temperature_state_topic(), payload))
       success = false;
   }
   if (traits.get_supports_two_point_target_temperature()) {
-    std::string payload = value_accuracy_to_string(this->device_->target_temperature_low, accuracy);
-    if (!this->publish(this->get_target_temperature_low_state_topic(), payload))
-      success = false;
-    payload = value_accuracy_to_string(this->device_->target_temperature_high, accuracy);
-    if (!this->publish(this->get_target_temperature_high_state_topic(), payload))
-      success = false;
-  } else {
+    if (fields & CLIMATE_FIELD_TARGET_TEMPERATURE_LOW) {
+      std::string payload = value_accuracy_to_string(this->device_->target_temperature_low, accuracy);
+      if (!this->publish(this->get_target_temperature_low_state_topic(), payload))
+        success = false;
+    }
+    if (fields & CLIMATE_FIELD_TARGET_TEMPERATURE_HIGH) {
+      std::string payload = value_accuracy_to_string(this->device_->target_temperature_high, accuracy);
+      if (!this->publish(this->get_target_temperature_high_state_topic(), payload))
+        success = false;
+    }
+  } else if (fields & CLIMATE_FIELD_TARGET_TEMPERATURE) {
     std::string payload = value_accuracy_to_string(this->device_->target_temperature, accuracy);
     if (!this->publish(this->get_target_temperature_state_topic(), payload))
       success = false;
   }
 
-  if (traits.get_supports_away()) {
+  if ((fields & CLIMATE_FIELD_AWAY) && traits.get_supports_away()) {
     std::string payload = ONOFF(this->device_->away);
     if (!this->publish(this->get_away_state_topic(), payload))
       success = false;
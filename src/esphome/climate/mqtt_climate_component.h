@@ -37,7 +37,8 @@ class MQTTClimateComponent : public mqtt::MQTTComponent {
  protected:
   std::string friendly_name() const override;
 
-  bool publish_state_();
+  /// Publish the ClimateStateFields in fields.
+  bool publish_state_(uint8_t fields);
 
   ClimateDevice *device_;
 };
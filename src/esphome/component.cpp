@@ -209,11 +209,13 @@ void PollingComponent::call_setup() {
   this->setup();
 
   // Register interval.
-  this->set_interval("update", this->get_update_interval(), [this]() { this->update(); });
+  if (!this->externally_polled_)
+    this->set_interval("update", this->get_update_interval(), [this]() { this->update(); });
 }
 
 uint32_t PollingComponent::get_update_interval() const { return this->update_interval_; }
 void PollingComponent::set_update_interval(uint32_t update_interval) { this->update_interval_ = update_interval; }
+void PollingComponent::set_externally_polled(bool externally_polled) { this->externally_polled_ = externally_polled; }
 
 const std::string &Nameable::get_name() const { return this->name_; }
 void Nameable::set_name(const std::string &name) {
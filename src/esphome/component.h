@@ -265,8 +265,16 @@ class PollingComponent : public Component {
   /// Get the update interval in ms of this sensor
   virtual uint32_t get_update_interval() const;
 
+  /** Don't register this component's own update interval, some other component triggers the updates.
+   *
+   * The update interval is still used for reporting (for example for expire_after), but update() is no
+   * longer called by this component. Must be called before setup().
+   */
+  void set_externally_polled(bool externally_polled);
+
  protected:
   uint32_t update_interval_;
+  bool externally_polled_{false};
 };
 
 /// Helper class that enables naming of objects so that it doesn't have to be re-implement every single time.
@@ -154,7 +154,6 @@ void Cover::stop() {
   call.set_command_stop();
   call.perform();
 }
-void Cover::add_on_state_callback(std::function<void()> &&f) { this->state_callback_.add(std::move(f)); }
 void Cover::publish_state(bool save) {
   this->position = clamp(0.0f, 1.0f, this->position);
   this->tilt = clamp(0.0f, 1.0f, this->tilt);
@@ -112,6 +112,7 @@
 #define USE_LCD_DISPLAY_PCF8574
 #define USE_SSD1306
 #define USE_WAVESHARE_EPAPER
+#define USE_SPI_TFT
 #define USE_DISPLAY
 #define USE_TIME
 #define USE_SNTP_COMPONENT
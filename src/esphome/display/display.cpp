@@ -17,6 +17,126 @@ namespace display {
 
 static const char *TAG = "display.display";
 
+/// Number of bits per pixel of the uncompressed image types.
+static uint8_t get_bits_per_pixel(ImageType type) {
+  switch (type) {
+    case IMAGE_TYPE_GRAYSCALE2:
+      return 2;
+    case IMAGE_TYPE_GRAYSCALE4:
+      return 4;
+    default:
+      return 1;
+  }
+}
+
+/** Call callback(x, y, length, alpha) for every run of pixels with equal coverage in a bitmap, row by row.
+ *
+ * All encodings are read a byte at a time instead of a pixel at a time. With threshold set, coverage is
+ * rounded to 0 or 255 so that monochrome displays get long runs they can draw without blending.
+ */
+template<typename F>
+static void HOT scan_bitmap_runs(const uint8_t *data, int width, int height, ImageType type, bool threshold,
+                                 F callback) {
+  if (type == IMAGE_TYPE_BINARY_RLE) {
+    for (int y = 0; y < height; y++) {
+      bool on = false;
+      for (int x = 0; x < width; on = !on) {
+        const uint8_t length = pgm_read_byte(data++);
+        if (length != 0)
+          callback(x, y, length, on ? 255 : 0);
+        x += length;
+      }
+    }
+    return;
+  }
+
+  const uint8_t bits = get_bits_per_pixel(type);
+  const uint8_t pixels_per_byte = 8 / bits;
+  const uint8_t mask = (1 << bits) - 1;
+  // scale the coverage to 0-255: 1 -> 255, 3 -> 85, 15 -> 17
+  const uint8_t scale = 255 / mask;
+  const int row_bytes = (width * bits + 7) / 8;
+  for (int y = 0; y < height; y++) {
+    const uint8_t *row = data + y * row_bytes;
+    int run_start = 0;
+    uint8_t run_alpha = 0;
+    uint8_t byte = 0;
+    for (int x = 0; x < width; x++) {
+      const uint8_t index = x % pixels_per_byte;
+      if (index == 0)
+        byte = pgm_read_byte(row + x / pixels_per_byte);
+      uint8_t alpha = ((byte >> (8 - bits - index * bits)) & mask) * scale;
+      if (threshold)
+        alpha = alpha >= 128 ? 255 : 0;
+      if (alpha != run_alpha) {
+        if (x != run_start)
+          callback(run_start, y, x - run_start, run_alpha);
+        run_start = x;
+        run_alpha = alpha;
+      }
+    }
+    callback(run_start, y, width - run_start, run_alpha);
+  }
+}
+/// Look up the coverage of a single pixel of a bitmap (with x and y already in range).
+static uint8_t get_bitmap_coverage(const uint8_t *data, int width, ImageType type, int x, int y) {
+  if (type == IMAGE_TYPE_BINARY_RLE) {
+    // walk the runs of all rows up to the pixel
+    int pos = 0;
+    const int target = x + y * width;
+    bool on = false;
+    int row_end = width;
+    while (true) {
+      const int length = pgm_read_byte(data++);
+      if (target < pos + length)
+        return on ? 255 : 0;
+      pos += length;
+      on = !on;
+      if (pos == row_end) {
+        row_end += width;
+        on = false;
+      }
+    }
+  }
+
+  const uint8_t bits = get_bits_per_pixel(type);
+  const uint8_t mask = (1 << bits) - 1;
+  const uint32_t row_bits = ((width * bits + 7u) / 8u) * 8u;
+  const uint32_t pos = x * bits + y * row_bits;
+  return ((pgm_read_byte(data + (pos / 8u)) >> (8u - bits - pos % 8u)) & mask) * (255 / mask);
+}
+
+uint16_t color_to_rgb565(int color) {
+  if (!(color & COLOR_RGB_FLAG))
+    return color ? 0xFFFF : 0x0000;
+  const uint8_t red = color >> 16, green = color >> 8, blue = color;
+  return ((red & 0xF8) << 8) | ((green & 0xFC) << 3) | (blue >> 3);
+}
+bool color_to_binary(int color) {
+  if (!(color & COLOR_RGB_FLAG))
+    return color != 0;
+  const uint8_t red = color >> 16, green = color >> 8, blue = color;
+  // integer approximation of the perceived brightness
+  return (red * 2u + green * 5u + blue) >= 8u * 128u;
+}
+int rgb565_to_color(uint16_t color565) {
+  const uint8_t red = (color565 >> 11) & 0x1F, green = (color565 >> 5) & 0x3F, blue = color565 & 0x1F;
+  return color_rgb((red << 3) | (red >> 2), (green << 2) | (green >> 4), (blue << 3) | (blue >> 2));
+}
+/// Integer lerp of a single channel, exact at alpha=0 and alpha=255.
+static inline uint8_t blend_channel(uint8_t background, uint8_t foreground, uint8_t alpha) {
+  const uint32_t value = foreground * uint32_t(alpha) + background * uint32_t(255 - alpha) + 128;
+  return (value + (value >> 8)) >> 8;
+}
+int blend_color(int background, int foreground, uint8_t alpha) {
+  if (!(background & COLOR_RGB_FLAG))
+    background = background ? 0xFFFFFF : 0x000000;
+  if (!(foreground & COLOR_RGB_FLAG))
+    foreground = foreground ? 0xFFFFFF : 0x000000;
+  return color_rgb(blend_channel(background >> 16, foreground >> 16, alpha),
+                   blend_channel(background >> 8, foreground >> 8, alpha), blend_channel(background, foreground, alpha));
+}
+
 void DisplayBuffer::init_internal_(uint32_t buffer_length) {
   this->buffer_ = new uint8_t[buffer_length];
   if (this->buffer_ == nullptr) {
@@ -50,27 +170,62 @@ int DisplayBuffer::get_height() {
   }
 }
 void DisplayBuffer::set_rotation(DisplayRotation rotation) { this->rotation_ = rotation; }
-void HOT DisplayBuffer::draw_pixel_at(int x, int y, int color) {
+void HOT DisplayBuffer::to_internal_(int *x, int *y) {
   switch (this->rotation_) {
     case DISPLAY_ROTATION_0_DEGREES:
       break;
     case DISPLAY_ROTATION_90_DEGREES:
-      std::swap(x, y);
-      x = this->get_width_internal() - x - 1;
+      std::swap(*x, *y);
+      *x = this->get_width_internal() - *x - 1;
       break;
     case DISPLAY_ROTATION_180_DEGREES:
-      x = this->get_width_internal() - x - 1;
-      y = this->get_height_internal() - y - 1;
+      *x = this->get_width_internal() - *x - 1;
+      *y = this->get_height_internal() - *y - 1;
       break;
     case DISPLAY_ROTATION_270_DEGREES:
-      std::swap(x, y);
-      y = this->get_height_internal() - y - 1;
+      std::swap(*x, *y);
+      *y = this->get_height_internal() - *y - 1;
       break;
   }
+}
+void HOT DisplayBuffer::draw_pixel_at(int x, int y, int color) {
+  x += this->offset_x_;
+  if (x < this->clip_x1_ || x >= this->clip_x2_)
+    return;
+  this->to_internal_(&x, &y);
+  if (y < this->band_start_ || y >= this->band_end_)
+    return;
+  if ((color & COLOR_RGB_FLAG) && !this->is_color_internal())
+    color = color_to_binary(color);
   this->draw_absolute_pixel_internal(x, y, color);
   feed_wdt();
 }
+bool DisplayBuffer::is_color_internal() { return false; }
+int DisplayBuffer::get_absolute_pixel_internal(int x, int y) { return COLOR_OFF; }
+void HOT DisplayBuffer::blend_horizontal_line_(int x, int y, int width, int color, uint8_t alpha) {
+  if (!this->is_color_internal()) {
+    if (alpha >= 128)
+      this->horizontal_line(x, y, width, color);
+    return;
+  }
+  const int width_internal = this->get_width_internal();
+  const int height_internal = this->get_height_internal();
+  for (int i = x; i < x + width; i++) {
+    int px = i + this->offset_x_, py = y;
+    if (px < this->clip_x1_ || px >= this->clip_x2_)
+      continue;
+    this->to_internal_(&px, &py);
+    if (px < 0 || px >= width_internal || py < this->band_start_ || py >= this->band_end_ || py >= height_internal)
+      continue;
+    const int background = this->get_absolute_pixel_internal(px, py);
+    this->draw_absolute_pixel_internal(px, py, blend_color(background, color, alpha));
+  }
+  feed_wdt();
+}
 void HOT DisplayBuffer::line(int x1, int y1, int x2, int y2, int color) {
+  if (this->is_outside_band_(std::min(x1, x2), std::min(y1, y2), abs(x2 - x1) + 1, abs(y2 - y1) + 1))
+    return;
+
   const int32_t dx = abs(x2 - x1), sx = x1 < x2 ? 1 : -1;
   const int32_t dy = -abs(y2 - y1), sy = y1 < y2 ? 1 : -1;
   int32_t err = dx + dy;
@@ -91,28 +246,54 @@ void HOT DisplayBuffer::line(int x1, int y1, int x2, int y2, int color) {
   }
 }
 void HOT DisplayBuffer::horizontal_line(int x, int y, int width, int color) {
+  if (this->is_outside_band_(x, y, width, 1))
+    return;
+
+  if (this->rotation_ == DISPLAY_ROTATION_0_DEGREES) {
+    // rows aren't rotated, so clip once and write the span straight into the buffer
+    x += this->offset_x_;
+    const int x_end = std::min(std::min(x + width, this->get_width_internal()), this->clip_x2_);
+    x = std::max(std::max(x, 0), this->clip_x1_);
+    if (y < 0 || y >= this->get_height_internal())
+      return;
+    if ((color & COLOR_RGB_FLAG) && !this->is_color_internal())
+      color = color_to_binary(color);
+    for (int i = x; i < x_end; i++)
+      this->draw_absolute_pixel_internal(i, y, color);
+    feed_wdt();
+    return;
+  }
   // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
   for (int i = x; i < x + width; i++)
     this->draw_pixel_at(i, y, color);
 }
 void HOT DisplayBuffer::vertical_line(int x, int y, int height, int color) {
+  if (this->is_outside_band_(x, y, 1, height))
+    return;
   // Future: Could be made more efficient by manipulating buffer directly in certain rotations.
   for (int i = y; i < y + height; i++)
     this->draw_pixel_at(x, i, color);
 }
 void DisplayBuffer::rectangle(int x1, int y1, int width, int height, int color) {
+  if (this->is_outside_band_(x1, y1, width, height))
+    return;
   this->horizontal_line(x1, y1, width, color);
   this->horizontal_line(x1, y1 + height - 1, width, color);
   this->vertical_line(x1, y1, height, color);
   this->vertical_line(x1 + width - 1, y1, height, color);
 }
 void DisplayBuffer::filled_rectangle(int x1, int y1, int width, int height, int color) {
+  if (this->is_outside_band_(x1, y1, width, height))
+    return;
   // Future: Use vertical_line and horizontal_line methods depending on rotation to reduce memory accesses.
   for (int i = y1; i < y1 + height; i++) {
     this->horizontal_line(x1, i, width, color);
   }
 }
 void HOT DisplayBuffer::circle(int center_x, int center_xy, int radius, int color) {
+  if (this->is_outside_band_(center_x - radius, center_xy - radius, 2 * radius + 1, 2 * radius + 1))
+    return;
+
   int dx = -radius;
   int dy = 0;
   int err = 2 - 2 * radius;
@@ -136,6 +317,9 @@ void HOT DisplayBuffer::circle(int center_x, int center_xy, int radius, int colo
   } while (dx <= 0);
 }
 void DisplayBuffer::filled_circle(int center_x, int center_y, int radius, int color) {
+  if (this->is_outside_band_(center_x - radius, center_y - radius, 2 * radius + 1, 2 * radius + 1))
+    return;
+
   int dx = -int32_t(radius);
   int dy = 0;
   int err = 2 - 2 * radius;
@@ -163,27 +347,24 @@ void DisplayBuffer::filled_circle(int center_x, int center_y, int radius, int co
 }
 
 void DisplayBuffer::print(int x, int y, Font *font, int color, TextAlign align, const char *text) {
+  const TextLayout &layout = this->get_text_layout_(text, font);
   int x_start, y_start;
   int width, height;
-  this->get_text_bounds(x, y, text, font, align, &x_start, &y_start, &width, &height);
+  this->align_text_(x, y, layout, align, &x_start, &y_start, &width, &height);
+  // glyph offsets can draw outside of the text box, so cull against what the glyphs actually cover
+  if (this->is_outside_band_(x_start + layout.ink_x, y_start + layout.ink_y, layout.ink_width, layout.ink_height))
+    return;
 
-  int i = 0;
   int x_at = x_start;
-  while (text[i] != '\0') {
-    int match_length;
-    int glyph_n = font->match_next_glyph(text + i, &match_length);
+  for (size_t i = 0; i < layout.glyphs.size(); i++) {
+    const int glyph_n = layout.glyphs[i];
     if (glyph_n < 0) {
-      // Unknown char, skip
-      ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", text[i]);
+      // Unknown char, draw a block instead
       if (!font->get_glyphs().empty()) {
         uint8_t glyph_width = font->get_glyphs()[0].width_;
-        for (int glyph_x = 0; glyph_x < glyph_width; glyph_x++)
-          for (int glyph_y = 0; glyph_y < height; glyph_y++)
-            this->draw_pixel_at(glyph_x + x_at, glyph_y + y_start, color);
+        this->filled_rectangle(x_at, y_start, glyph_width, height, color);
         x_at += glyph_width;
       }
-
-      i++;
       continue;
     }
 
@@ -191,17 +372,18 @@ void DisplayBuffer::print(int x, int y, Font *font, int color, TextAlign align,
     int scan_x1, scan_y1, scan_width, scan_height;
     glyph.scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
 
-    for (int glyph_x = scan_x1; glyph_x < scan_x1 + scan_width; glyph_x++) {
-      for (int glyph_y = scan_y1; glyph_y < scan_y1 + scan_height; glyph_y++) {
-        if (glyph.get_pixel(glyph_x, glyph_y)) {
-          this->draw_pixel_at(glyph_x + x_at, glyph_y + y_start, color);
-        }
-      }
+    if (!this->is_outside_band_(x_at + scan_x1, y_start + scan_y1, scan_width, scan_height)) {
+      const int glyph_x = x_at + scan_x1, glyph_y = y_start + scan_y1;
+      scan_bitmap_runs(glyph.data_, glyph.width_, glyph.height_, glyph.type_, !this->is_color_internal(),
+                       [this, glyph_x, glyph_y, color](int run_x, int run_y, int length, uint8_t alpha) {
+                         if (alpha == 255)
+                           this->horizontal_line(glyph_x + run_x, glyph_y + run_y, length, color);
+                         else if (alpha != 0)
+                           this->blend_horizontal_line_(glyph_x + run_x, glyph_y + run_y, length, color, alpha);
+                       });
     }
 
     x_at += glyph.width_ + glyph.offset_x_;
-
-    i += match_length;
   }
 }
 void DisplayBuffer::vprintf_(int x, int y, Font *font, int color, TextAlign align, const char *format, va_list arg) {
@@ -210,17 +392,37 @@ void DisplayBuffer::vprintf_(int x, int y, Font *font, int color, TextAlign alig
   if (ret > 0)
     this->print(x, y, font, color, align, buffer);
 }
-void DisplayBuffer::image(int x, int y, Image *image) {
-  for (int img_x = 0; img_x < image->get_width(); img_x++) {
-    for (int img_y = 0; img_y < image->get_height(); img_y++) {
-      this->draw_pixel_at(x + img_x, y + img_y, image->get_pixel(img_x, img_y) ? COLOR_ON : COLOR_OFF);
-    }
+void DisplayBuffer::image(int x, int y, Image *image) { this->image(x, y, image, COLOR_ON, COLOR_OFF); }
+void DisplayBuffer::image(int x, int y, Image *image, int color_on, int color_off) {
+  if (this->is_outside_band_(x, y, image->get_width(), image->get_height()))
+    return;
+
+  const ImageType type = image->get_type();
+  if (type == IMAGE_TYPE_BINARY || type == IMAGE_TYPE_BINARY_RLE) {
+    scan_bitmap_runs(image->get_data_start(), image->get_width(), image->get_height(), type, false,
+                     [this, x, y, color_on, color_off](int run_x, int run_y, int length, uint8_t alpha) {
+                       this->horizontal_line(x + run_x, y + run_y, length, alpha != 0 ? color_on : color_off);
+                     });
+    return;
   }
+
+  scan_bitmap_runs(image->get_data_start(), image->get_width(), image->get_height(), type,
+                   !this->is_color_internal(), [this, x, y, color_on](int run_x, int run_y, int length, uint8_t alpha) {
+                     if (alpha == 255)
+                       this->horizontal_line(x + run_x, y + run_y, length, color_on);
+                     else if (alpha != 0)
+                       this->blend_horizontal_line_(x + run_x, y + run_y, length, color_on, alpha);
+                   });
 }
 void DisplayBuffer::get_text_bounds(int x, int y, const char *text, Font *font, TextAlign align, int *x1, int *y1,
                                     int *width, int *height) {
-  int x_offset, baseline;
-  font->measure(text, width, &x_offset, &baseline, height);
+  this->align_text_(x, y, this->get_text_layout_(text, font), align, x1, y1, width, height);
+}
+void DisplayBuffer::align_text_(int x, int y, const TextLayout &layout, TextAlign align, int *x1, int *y1,
+                                int *width, int *height) {
+  *width = layout.width;
+  *height = layout.font->get_height();
+  const int baseline = layout.font->get_baseline();
 
   auto x_align = TextAlign(int(align) & 0x18);
   auto y_align = TextAlign(int(align) & 0x07);
@@ -255,6 +457,77 @@ void DisplayBuffer::get_text_bounds(int x, int y, const char *text, Font *font,
       break;
   }
 }
+const TextLayout &DisplayBuffer::get_text_layout_(const char *text, Font *font) {
+  const size_t length = strlen(text);
+  const uint32_t hash = fnv1_hash(text, length);
+  const uint32_t now = ++this->text_layout_counter_;
+  if (this->text_layout_cache_size_ != 0) {
+    for (auto &layout : this->text_layouts_) {
+      // the hash only rejects quickly, the text is compared too so that collisions can't draw the wrong string
+      if (layout.hash == hash && layout.font == font && layout.text == text) {
+        layout.last_used = now;
+        return layout;
+      }
+    }
+  }
+
+  // evict the least recently used layout (with the cache disabled, the single slot is always reused)
+  TextLayout *layout;
+  if (this->text_layouts_.size() < std::max<size_t>(this->text_layout_cache_size_, 1)) {
+    this->text_layouts_.emplace_back();
+    layout = &this->text_layouts_.back();
+  } else {
+    layout = &this->text_layouts_[0];
+    for (auto &other : this->text_layouts_) {
+      if (other.last_used < layout->last_used)
+        layout = &other;
+    }
+  }
+  layout->font = font;
+  layout->hash = hash;
+  layout->text.assign(text, length);
+  layout->last_used = now;
+  font->layout(text, &layout->glyphs, &layout->width, &layout->x_offset);
+
+  // walk the glyphs like print() does to find the area they draw to
+  int x1 = INT32_MAX, y1 = INT32_MAX, x2 = INT32_MIN, y2 = INT32_MIN;
+  int x_at = 0;
+  for (int16_t glyph_n : layout->glyphs) {
+    int scan_x1, scan_y1, scan_width, scan_height;
+    if (glyph_n < 0) {
+      if (font->get_glyphs().empty())
+        continue;
+      // the block drawn for unknown chars
+      scan_x1 = x_at;
+      scan_y1 = 0;
+      scan_width = font->get_glyphs()[0].width_;
+      scan_height = font->get_height();
+      x_at += scan_width;
+    } else {
+      const Glyph &glyph = font->get_glyphs()[glyph_n];
+      glyph.scan_area(&scan_x1, &scan_y1, &scan_width, &scan_height);
+      scan_x1 += x_at;
+      x_at += glyph.width_ + glyph.offset_x_;
+    }
+    x1 = std::min(x1, scan_x1);
+    y1 = std::min(y1, scan_y1);
+    x2 = std::max(x2, scan_x1 + scan_width);
+    y2 = std::max(y2, scan_y1 + scan_height);
+  }
+  if (x1 > x2) {
+    // nothing is drawn
+    x1 = x2 = y1 = y2 = 0;
+  }
+  layout->ink_x = x1;
+  layout->ink_y = y1;
+  layout->ink_width = x2 - x1;
+  layout->ink_height = y2 - y1;
+  return *layout;
+}
+void DisplayBuffer::set_text_layout_cache_size(uint8_t text_layout_cache_size) {
+  this->text_layout_cache_size_ = text_layout_cache_size;
+  this->text_layouts_.clear();
+}
 void DisplayBuffer::print(int x, int y, Font *font, int color, const char *text) {
   this->print(x, y, font, color, TextAlign::TOP_LEFT, text);
 }
@@ -301,17 +574,138 @@ void DisplayBuffer::set_pages(std::vector<DisplayPage *> pages) {
   pages[pages.size() - 1]->set_next(pages[0]);
   this->show_page(pages[0]);
 }
-void DisplayBuffer::show_page(DisplayPage *page) { this->page_ = page; }
+void DisplayBuffer::show_page(DisplayPage *page) {
+  if (this->transition_ != DISPLAY_TRANSITION_NONE && this->frame_interval_ != 0 && this->page_ != nullptr &&
+      page != this->page_) {
+    this->transition_from_ = this->page_;
+    this->transition_start_ = millis();
+  }
+  this->page_ = page;
+  this->request_frame();
+}
 void DisplayBuffer::show_next_page() { this->page_->show_next(); }
 void DisplayBuffer::show_prev_page() { this->page_->show_prev(); }
 void DisplayBuffer::do_update_() {
+  if (this->band_start_ <= 0) {
+    // all bands of a frame show the same point of the transition
+    this->frame_time_ = millis();
+    this->frame_skipped_ = false;
+  }
   this->clear();
+  if (this->transition_from_ != nullptr && this->draw_transition_())
+    return;
   if (this->page_ != nullptr) {
     this->page_->get_writer()(*this);
   } else if (this->writer_.has_value()) {
     (*this->writer_)(*this);
   }
 }
+bool DisplayBuffer::draw_transition_() {
+  const uint32_t elapsed = this->frame_time_ - this->transition_start_;
+  if (elapsed >= this->transition_length_) {
+    this->transition_from_ = nullptr;
+    return false;
+  }
+
+  const int width = this->get_width();
+  const int shift = int((uint64_t(elapsed) * width) / this->transition_length_);
+  const display_writer_t &from = this->transition_from_->get_writer();
+  const display_writer_t &to = this->page_->get_writer();
+  switch (this->transition_) {
+    case DISPLAY_TRANSITION_SLIDE_LEFT:
+      this->draw_clipped_(from, -shift, 0, width - shift);
+      this->draw_clipped_(to, width - shift, width - shift, width);
+      break;
+    case DISPLAY_TRANSITION_SLIDE_RIGHT:
+      this->draw_clipped_(from, shift, shift, width);
+      this->draw_clipped_(to, shift - width, 0, shift);
+      break;
+    case DISPLAY_TRANSITION_WIPE:
+    default:
+      this->draw_clipped_(from, 0, shift, width);
+      this->draw_clipped_(to, 0, 0, shift);
+      break;
+  }
+  return true;
+}
+void DisplayBuffer::draw_clipped_(const display_writer_t &writer, int offset_x, int clip_x1, int clip_x2) {
+  this->offset_x_ = offset_x;
+  this->clip_x1_ = clip_x1;
+  this->clip_x2_ = clip_x2;
+  writer(*this);
+  this->offset_x_ = 0;
+  this->clip_x1_ = INT32_MIN;
+  this->clip_x2_ = INT32_MAX;
+}
+bool DisplayBuffer::is_clipped_() const { return this->clip_x1_ != INT32_MIN || this->clip_x2_ != INT32_MAX; }
+void DisplayBuffer::set_frame_rate(uint8_t frame_rate) {
+  this->frame_interval_ = frame_rate == 0 ? 0 : std::max(1000u / frame_rate, 1u);
+}
+void DisplayBuffer::set_frame_budget(uint8_t frame_budget) {
+  this->frame_budget_ = clamp<uint8_t>(1, 100, frame_budget);
+}
+void DisplayBuffer::set_transition(DisplayTransition transition, uint32_t transition_length) {
+  this->transition_ = transition;
+  this->transition_length_ = transition_length;
+}
+void DisplayBuffer::request_frame() { this->frame_requested_ = true; }
+void DisplayBuffer::skip_frame() { this->frame_skipped_ = true; }
+bool DisplayBuffer::is_frame_skipped_() const {
+  return this->frame_skipped_ && this->transition_from_ == nullptr;
+}
+bool DisplayBuffer::should_render_frame_() {
+  if (this->frame_interval_ == 0)
+    return false;
+  if (!this->frame_requested_ && this->transition_from_ == nullptr)
+    return false;
+  return millis() - this->last_frame_ >= this->next_frame_delay_;
+}
+void DisplayBuffer::frame_rendered_(uint32_t render_time_us) {
+  this->last_frame_ = millis();
+  this->frame_requested_ = false;
+  // wait long enough that rendering stays within the budget, even if that's longer than the frame interval
+  const uint32_t render_time = render_time_us / 1000u;
+  const uint32_t budget_delay = render_time * (100u - this->frame_budget_) / this->frame_budget_;
+  const uint32_t interval_delay = this->frame_interval_ > render_time ? this->frame_interval_ - render_time : 0;
+  this->next_frame_delay_ = std::max(budget_delay, interval_delay);
+}
+void DisplayBuffer::do_update_band_(int y_start, int y_end) {
+  this->band_start_ = y_start;
+  this->band_end_ = y_end;
+  this->do_update_();
+}
+bool DisplayBuffer::is_outside_band_(int x, int y, int width, int height) {
+  x += this->offset_x_;
+  if (x + width <= this->clip_x1_ || x >= this->clip_x2_)
+    return true;
+
+  const int internal_height = this->get_height_internal();
+  if (this->band_start_ <= 0 && this->band_end_ >= internal_height)
+    return false;
+
+  // the rows of the unrotated display the rectangle covers, see draw_pixel_at()
+  int y1, y2;
+  switch (this->rotation_) {
+    case DISPLAY_ROTATION_90_DEGREES:
+      y1 = x;
+      y2 = x + width;
+      break;
+    case DISPLAY_ROTATION_180_DEGREES:
+      y1 = internal_height - y - height;
+      y2 = internal_height - y;
+      break;
+    case DISPLAY_ROTATION_270_DEGREES:
+      y1 = internal_height - x - width;
+      y2 = internal_height - x;
+      break;
+    case DISPLAY_ROTATION_0_DEGREES:
+    default:
+      y1 = y;
+      y2 = y + height;
+      break;
+  }
+  return y2 <= this->band_start_ || y1 >= this->band_end_;
+}
 #ifdef USE_TIME
 void DisplayBuffer::strftime(int x, int y, Font *font, int color, TextAlign align, const char *format,
                              time::ESPTime time) {
@@ -332,21 +726,20 @@ void DisplayBuffer::strftime(int x, int y, Font *font, const char *format, time:
 #endif
 
 Glyph::Glyph(const char *a_char, const uint8_t *data_start, uint32_t offset, int offset_x, int offset_y, int width,
-             int height)
+             int height, ImageType type)
     : char_(a_char),
       data_(data_start + offset),
       offset_x_(offset_x),
       offset_y_(offset_y),
       width_(width),
-      height_(height) {}
+      height_(height),
+      type_(type) {}
 bool Glyph::get_pixel(int x, int y) const {
   const int x_data = x - this->offset_x_;
   const int y_data = y - this->offset_y_;
   if (x_data < 0 || x_data >= this->width_ || y_data < 0 || y_data >= this->height_)
     return false;
-  const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
-  const uint32_t pos = x_data + y_data * width_8;
-  return pgm_read_byte(this->data_ + (pos / 8u)) & (0x80 >> (pos % 8u));
+  return get_bitmap_coverage(this->data_, this->width_, this->type_, x_data, y_data) >= 128;
 }
 const char *Glyph::get_char() const { return this->char_; }
 bool Glyph::compare_to(const char *str) const {
@@ -399,6 +792,11 @@ int Font::match_next_glyph(const char *str, int *match_length) {
 void Font::measure(const char *str, int *width, int *x_offset, int *baseline, int *height) {
   *baseline = this->baseline_;
   *height = this->bottom_;
+  this->layout(str, nullptr, width, x_offset);
+}
+void Font::layout(const char *str, std::vector<int16_t> *glyphs, int *width, int *x_offset) {
+  if (glyphs != nullptr)
+    glyphs->clear();
   int i = 0;
   int min_x = 0;
   bool has_char = false;
@@ -406,8 +804,12 @@ void Font::measure(const char *str, int *width, int *x_offset, int *baseline, in
   while (str[i] != '\0') {
     int match_length;
     int glyph_n = this->match_next_glyph(str + i, &match_length);
+    if (glyphs != nullptr)
+      glyphs->push_back(glyph_n);
     if (glyph_n < 0) {
       // Unknown char, skip
+      if (glyphs != nullptr)
+        ESP_LOGW(TAG, "Encountered character without representation in font: '%c'", str[i]);
       if (!this->get_glyphs().empty())
         x += this->get_glyphs()[0].width_;
       i++;
@@ -427,6 +829,8 @@ void Font::measure(const char *str, int *width, int *x_offset, int *baseline, in
   *x_offset = min_x;
   *width = x - min_x;
 }
+int Font::get_baseline() const { return this->baseline_; }
+int Font::get_height() const { return this->bottom_; }
 const std::vector<Glyph> &Font::get_glyphs() const { return this->glyphs_; }
 Font::Font(std::vector<Glyph> &&glyphs, int baseline, int bottom)
     : glyphs_(std::move(glyphs)), baseline_(baseline), bottom_(bottom) {}
@@ -434,14 +838,19 @@ Font::Font(std::vector<Glyph> &&glyphs, int baseline, int bottom)
 bool Image::get_pixel(int x, int y) const {
   if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
     return false;
-  const uint32_t width_8 = ((this->width_ + 7u) / 8u) * 8u;
-  const uint32_t pos = x + y * width_8;
-  return pgm_read_byte(this->data_start_ + (pos / 8u)) & (0x80 >> (pos % 8u));
+  return this->get_coverage(x, y) >= 128;
+}
+uint8_t Image::get_coverage(int x, int y) const {
+  if (x < 0 || x >= this->width_ || y < 0 || y >= this->height_)
+    return 0;
+  return get_bitmap_coverage(this->data_start_, this->width_, this->type_, x, y);
 }
 int Image::get_width() const { return this->width_; }
 int Image::get_height() const { return this->height_; }
-Image::Image(const uint8_t *data_start, int width, int height)
-    : width_(width), height_(height), data_start_(data_start) {}
+ImageType Image::get_type() const { return this->type_; }
+const uint8_t *Image::get_data_start() const { return this->data_start_; }
+Image::Image(const uint8_t *data_start, int width, int height, ImageType type)
+    : width_(width), height_(height), data_start_(data_start), type_(type) {}
 
 DisplayPage::DisplayPage(const display_writer_t &writer) : writer_(writer) {}
 void DisplayPage::show() { this->parent_->show_page(this); }
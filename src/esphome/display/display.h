@@ -69,6 +69,17 @@ enum class TextAlign {
 extern const uint8_t COLOR_OFF;
 /// Turn the pixel ON.
 extern const uint8_t COLOR_ON;
+/// Marks an `int color` as a 24-bit RGB value, see color_rgb().
+static const int COLOR_RGB_FLAG = 0x1000000;
+
+/** Create a 24-bit RGB color.
+ *
+ * Colour displays show the color as is, monochrome displays turn the pixel on if the color is brighter
+ * than 50%. In the other direction, colour displays show COLOR_ON as white and COLOR_OFF as black.
+ */
+inline int color_rgb(uint8_t red, uint8_t green, uint8_t blue) {
+  return COLOR_RGB_FLAG | (int(red) << 16) | (int(green) << 8) | int(blue);
+}
 
 namespace display {
 
@@ -79,11 +90,67 @@ enum DisplayRotation {
   DISPLAY_ROTATION_270_DEGREES = 270,
 };
 
+enum DisplayTransition {
+  DISPLAY_TRANSITION_NONE = 0,
+  /// The new page pushes the old one out to the left.
+  DISPLAY_TRANSITION_SLIDE_LEFT,
+  /// The new page pushes the old one out to the right.
+  DISPLAY_TRANSITION_SLIDE_RIGHT,
+  /// The new page is uncovered from left to right.
+  DISPLAY_TRANSITION_WIPE,
+};
+
 class Font;
 class Image;
 class DisplayBuffer;
 class DisplayPage;
 
+/** How the pixels of an Image or Glyph are stored in flash.
+ *
+ * - BINARY: 1 bit per pixel, rows padded to whole bytes, MSB first.
+ * - BINARY_RLE: every row is a sequence of run lengths (one byte each) of alternating unset and set pixels,
+ *   starting with unset pixels. Runs longer than 255 pixels are split with a zero length run in between.
+ * - GRAYSCALE2/GRAYSCALE4: 2 or 4 bits of coverage per pixel, rows padded to whole bytes, MSB first. The color
+ *   is blended over what's already on the screen by the coverage (0 is transparent). Monochrome displays
+ *   draw every pixel with at least 50% coverage.
+ */
+enum ImageType {
+  IMAGE_TYPE_BINARY = 0,
+  IMAGE_TYPE_BINARY_RLE,
+  IMAGE_TYPE_GRAYSCALE2,
+  IMAGE_TYPE_GRAYSCALE4,
+};
+
+/** The glyphs and dimensions of a piece of text, see Font::layout().
+ *
+ * DisplayBuffer keeps the layouts of recently printed strings so that text that's redrawn every update
+ * skips the glyph lookup.
+ */
+struct TextLayout {
+  Font *font;
+  uint32_t hash;
+  std::string text;
+  /// The index of the glyph for each character, -1 for characters the font doesn't have.
+  std::vector<int16_t> glyphs;
+  int width;
+  int x_offset;
+  /// The union of the areas the glyphs draw to, relative to the top left of the aligned text.
+  int ink_x;
+  int ink_y;
+  int ink_width;
+  int ink_height;
+  uint32_t last_used;
+};
+
+/// Convert a color to the RGB565 format used by colour TFTs.
+uint16_t color_to_rgb565(int color);
+/// Convert a color to the pixel state of a monochrome display.
+bool color_to_binary(int color);
+/// Convert an RGB565 pixel back to a color.
+int rgb565_to_color(uint16_t color565);
+/// Mix foreground over background, alpha=0 gives the background and alpha=255 the foreground.
+int blend_color(int background, int foreground, uint8_t alpha);
+
 using display_writer_t = std::function<void(DisplayBuffer &)>;
 
 #define LOG_DISPLAY(prefix, type, obj) \
@@ -268,6 +335,12 @@ class DisplayBuffer {
   /// Draw the `image` with the top-left corner at [x,y] to the screen.
   void image(int x, int y, Image *image);
 
+  /** Draw the `image` with the top-left corner at [x,y], using color_on and color_off for its set and unset pixels.
+   *
+   * Grayscale images are drawn with color_on blended by the coverage of each pixel, color_off isn't used.
+   */
+  void image(int x, int y, Image *image, int color_on, int color_off);
+
   /** Get the text bounds of the given string.
    *
    * @param x The x coordinate to place the string at, can be 0 if only interested in dimensions.
@@ -295,23 +368,110 @@ class DisplayBuffer {
   /// Internal method to set the display rotation with.
   void set_rotation(DisplayRotation rotation);
 
+  /// Set how many text layouts to keep for repeated print() calls, 0 disables the cache. Defaults to 8.
+  void set_text_layout_cache_size(uint8_t text_layout_cache_size);
+
+  /** Render frames from loop() at up to this rate when something changed, in addition to update().
+   *
+   * 0 (the default) only renders on update(). Only displays that can push frames quickly (SSD1306, SPI TFTs)
+   * have a frame loop, page transitions require it.
+   */
+  void set_frame_rate(uint8_t frame_rate);
+  /// Limit the share of time spent rendering frames (in percent), the frame rate drops if frames are slower.
+  void set_frame_budget(uint8_t frame_budget);
+  /// Animate page changes with this transition.
+  void set_transition(DisplayTransition transition, uint32_t transition_length);
+
+  /// Render a new frame as soon as the frame rate allows, for example when the data shown has changed.
+  void request_frame();
+  /** Tell the display that the writer has nothing new to show, the frame isn't sent to the panel.
+   *
+   * Call this at the start of the writer. It's ignored during page transitions.
+   */
+  void skip_frame();
+
  protected:
   void vprintf_(int x, int y, Font *font, int color, TextAlign align, const char *format, va_list arg);
 
   virtual void draw_absolute_pixel_internal(int x, int y, int color) = 0;
 
+  /// Read back a pixel for blending, only called on displays for which is_color_internal() is true.
+  virtual int get_absolute_pixel_internal(int x, int y);
+
   virtual int get_height_internal() = 0;
 
   virtual int get_width_internal() = 0;
 
+  /// Whether draw_absolute_pixel_internal understands RGB colors, otherwise they're converted to COLOR_ON/COLOR_OFF.
+  virtual bool is_color_internal();
+
   void init_internal_(uint32_t buffer_length);
 
   void do_update_();
 
+  /** Run the writer for the rows [y_start, y_end) of the (unrotated) display only.
+   *
+   * Pixels outside of the band are dropped before they reach draw_absolute_pixel_internal, so a display
+   * can render the screen in several bands with a buffer that only holds one of them.
+   */
+  void do_update_band_(int y_start, int y_end);
+
+  /// Whether the rectangle (in rotated coordinates) lies completely outside the band that's being rendered.
+  bool is_outside_band_(int x, int y, int width, int height);
+
+  /// Whether drawing is shifted/clipped for a page transition, fill() overrides have to respect the clip then.
+  bool is_clipped_() const;
+  /// Draw a writer shifted by offset_x and clipped to the columns [clip_x1, clip_x2).
+  void draw_clipped_(const display_writer_t &writer, int offset_x, int clip_x1, int clip_x2);
+  /// Draw the current frame of the page transition, returns false if the transition has ended.
+  bool draw_transition_();
+
+  /// Whether it's time to render a frame from loop(), see set_frame_rate().
+  bool should_render_frame_();
+  /// Call after a frame rendered from loop() with its render time to schedule the next one.
+  void frame_rendered_(uint32_t render_time_us);
+  /// Whether the writer called skip_frame() and the frame shouldn't be sent to the panel.
+  bool is_frame_skipped_() const;
+
+  /// Convert rotated coordinates to the coordinates of the unrotated display.
+  void to_internal_(int *x, int *y);
+
+  /// Blend color over the pixels [x,y] to [x+width,y] with the given alpha.
+  void blend_horizontal_line_(int x, int y, int width, int color, uint8_t alpha);
+
+  /// Get the layout of text from the cache, or lay it out and store it in the cache.
+  const TextLayout &get_text_layout_(const char *text, Font *font);
+  void align_text_(int x, int y, const TextLayout &layout, TextAlign align, int *x1, int *y1, int *width,
+                   int *height);
+
   uint8_t *buffer_{nullptr};
+  /// The rows of the display the buffer currently holds.
+  int band_start_{0};
+  int band_end_{INT32_MAX};
   DisplayRotation rotation_{DISPLAY_ROTATION_0_DEGREES};
   optional<display_writer_t> writer_{};
   DisplayPage *page_{nullptr};
+  std::vector<TextLayout> text_layouts_;
+  uint8_t text_layout_cache_size_{8};
+  uint32_t text_layout_counter_{0};
+
+  /// Shift and clip of the drawing operations (in rotated coordinates), for page transitions.
+  int offset_x_{0};
+  int clip_x1_{INT32_MIN};
+  int clip_x2_{INT32_MAX};
+
+  uint32_t frame_interval_{0};
+  uint8_t frame_budget_{50};
+  uint32_t last_frame_{0};
+  uint32_t next_frame_delay_{0};
+  uint32_t frame_time_{0};
+  bool frame_requested_{false};
+  bool frame_skipped_{false};
+
+  DisplayTransition transition_{DISPLAY_TRANSITION_NONE};
+  uint32_t transition_length_{0};
+  uint32_t transition_start_{0};
+  DisplayPage *transition_from_{nullptr};
 };
 
 class DisplayPage {
@@ -335,7 +495,7 @@ class DisplayPage {
 class Glyph {
  public:
   Glyph(const char *a_char, const uint8_t *data_start, uint32_t offset, int offset_x, int offset_y, int width,
-        int height);
+        int height, ImageType type = IMAGE_TYPE_BINARY);
 
   bool get_pixel(int x, int y) const;
 
@@ -357,6 +517,7 @@ class Glyph {
   int offset_y_;
   int width_;
   int height_;
+  ImageType type_;
 };
 
 class Font {
@@ -373,6 +534,12 @@ class Font {
 
   void measure(const char *str, int *width, int *x_offset, int *baseline, int *height);
 
+  /// Resolve the glyphs of str (if glyphs isn't null) and calculate its width and x offset.
+  void layout(const char *str, std::vector<int16_t> *glyphs, int *width, int *x_offset);
+
+  int get_baseline() const;
+  int get_height() const;
+
   const std::vector<Glyph> &get_glyphs() const;
 
  protected:
@@ -383,15 +550,21 @@ class Font {
 
 class Image {
  public:
-  Image(const uint8_t *data_start, int width, int height);
+  Image(const uint8_t *data_start, int width, int height, ImageType type = IMAGE_TYPE_BINARY);
+  /// Get a single pixel. Slow for compressed images, DisplayBuffer::image() decodes whole rows instead.
   bool get_pixel(int x, int y) const;
   int get_width() const;
   int get_height() const;
+  ImageType get_type() const;
+  const uint8_t *get_data_start() const;
+  /// Get the coverage of a single pixel (0-255), binary images return 0 or 255.
+  uint8_t get_coverage(int x, int y) const;
 
  protected:
   int width_;
   int height_;
   const uint8_t *data_start_;
+  ImageType type_;
 };
 
 template<typename... Ts> class DisplayPageShowAction : public Action<Ts...> {
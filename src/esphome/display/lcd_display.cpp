@@ -34,8 +34,12 @@ static const uint8_t LCD_DISPLAY_FUNCTION_5X10_DOTS = 0x04;
 
 void LCDDisplay::setup() {
   this->buffer_ = new uint8_t[this->rows_ * this->columns_];
-  for (uint8_t i = 0; i < this->rows_ * this->columns_; i++)
+  this->shadow_ = new uint8_t[this->rows_ * this->columns_];
+  for (uint8_t i = 0; i < this->rows_ * this->columns_; i++) {
     this->buffer_[i] = ' ';
+    // matches the panel after the clear display command below
+    this->shadow_[i] = ' ';
+  }
 
   uint8_t display_function = 0;
 
@@ -85,25 +89,33 @@ void LCDDisplay::setup() {
 
 float LCDDisplay::get_setup_priority() const { return setup_priority::POST_HARDWARE; }
 void HOT LCDDisplay::display() {
-  this->command_(LCD_DISPLAY_COMMAND_SET_DDRAM_ADDR | 0);
-
-  for (uint8_t i = 0; i < this->columns_; i++)
-    this->send(this->buffer_[i], true);
-
-  if (this->rows_ >= 3) {
-    for (uint8_t i = 0; i < this->columns_; i++)
-      this->send(this->buffer_[this->columns_ * 2 + i], true);
-  }
-
-  if (this->rows_ >= 1) {
-    this->command_(LCD_DISPLAY_COMMAND_SET_DDRAM_ADDR | 0x40);
-
-    for (uint8_t i = 0; i < this->columns_; i++)
-      this->send(this->buffer_[this->columns_ + i], true);
-
-    if (this->rows_ >= 4) {
-      for (uint8_t i = 0; i < this->columns_; i++)
-        this->send(this->buffer_[this->columns_ * 3 + i], true);
+  this->upload_glyphs_();
+
+  for (uint8_t row = 0; row < this->rows_; row++) {
+    // rows 2 and 3 continue where rows 0 and 1 end in DDRAM
+    const uint8_t row_address = (row & 1 ? 0x40 : 0x00) + (row >= 2 ? this->columns_ : 0);
+    const uint8_t *buffer = this->buffer_ + row * this->columns_;
+    uint8_t *shadow = this->shadow_ + row * this->columns_;
+
+    uint8_t column = 0;
+    while (column < this->columns_) {
+      if (buffer[column] == shadow[column]) {
+        column++;
+        continue;
+      }
+
+      // a run of changed characters; a single unchanged character in between is cheaper to
+      // write again than moving the address with another command
+      uint8_t end = column + 1;
+      while (end < this->columns_ &&
+             (buffer[end] != shadow[end] || (end + 1 < this->columns_ && buffer[end + 1] != shadow[end + 1])))
+        end++;
+
+      this->command_(LCD_DISPLAY_COMMAND_SET_DDRAM_ADDR | (row_address + column));
+      for (; column < end; column++) {
+        this->send(buffer[column], true);
+        shadow[column] = buffer[column];
+      }
     }
   }
 }
@@ -111,9 +123,56 @@ void LCDDisplay::update() {
   for (uint8_t i = 0; i < this->rows_ * this->columns_; i++)
     this->buffer_[i] = ' ';
 
+  this->update_count_++;
   this->writer_(*this);
   this->display();
 }
+void LCDDisplay::print_glyph(uint8_t column, uint8_t row, const uint8_t *glyph) {
+  const uint16_t pos = column + row * this->columns_;
+  if (column >= this->columns_ || pos >= this->rows_ * this->columns_) {
+    ESP_LOGW(TAG, "LCDDisplay writing out of range!");
+    return;
+  }
+
+  CustomChar *lru = nullptr;
+  for (uint8_t i = 0; i < 8; i++) {
+    CustomChar *custom = &this->custom_chars_[i];
+    if (custom->used && memcmp(custom->glyph, glyph, 8) == 0) {
+      custom->last_used = this->update_count_;
+      this->buffer_[pos] = i;
+      return;
+    }
+    // characters still shown in this update can't be replaced
+    if (custom->used && custom->last_used == this->update_count_)
+      continue;
+    if (lru == nullptr || !custom->used || (lru->used && custom->last_used < lru->last_used))
+      lru = custom;
+  }
+
+  if (lru == nullptr) {
+    ESP_LOGW(TAG, "More than 8 custom characters in one update!");
+    return;
+  }
+
+  memcpy(lru->glyph, glyph, 8);
+  lru->last_used = this->update_count_;
+  lru->used = true;
+  lru->dirty = true;
+  this->buffer_[pos] = lru - this->custom_chars_;
+}
+void LCDDisplay::upload_glyphs_() {
+  for (uint8_t i = 0; i < 8; i++) {
+    CustomChar *custom = &this->custom_chars_[i];
+    if (!custom->dirty)
+      continue;
+
+    // characters showing this slot change with it, DDRAM is addressed again before the next write
+    this->command_(LCD_DISPLAY_COMMAND_SET_CGRAM_ADDR | (i << 3));
+    for (uint8_t line : custom->glyph)
+      this->send(line & 0x1F, true);
+    custom->dirty = false;
+  }
+}
 void LCDDisplay::command_(uint8_t value) { this->send(value, false); }
 void LCDDisplay::print(uint8_t column, uint8_t row, const char *str) {
   uint8_t pos = column + row * this->columns_;
@@ -218,20 +277,25 @@ void GPIOLCDDisplay::set_enable_pin(const GPIOOutputPin &enable) { this->enable_
 void GPIOLCDDisplay::set_rs_pin(const GPIOOutputPin &rs) { this->rs_pin_ = rs.copy(); }
 void GPIOLCDDisplay::set_rw_pin(const GPIOOutputPin &rw) { this->rw_pin_ = rw.copy(); }
 bool GPIOLCDDisplay::is_four_bit_mode() { return this->data_pins_[4] == nullptr; }
-void GPIOLCDDisplay::write_n_bits(uint8_t value, uint8_t n) {
+void GPIOLCDDisplay::pulse_n_bits_(uint8_t value, uint8_t n) {
   for (uint8_t i = 0; i < n; i++)
     this->data_pins_[i]->digital_write(value & (1 << i));
 
   this->enable_pin_->digital_write(true);
   delayMicroseconds(1);  // >450ns
   this->enable_pin_->digital_write(false);
+}
+void GPIOLCDDisplay::write_n_bits(uint8_t value, uint8_t n) {
+  this->pulse_n_bits_(value, n);
   delayMicroseconds(40);  // >37us
 }
 void GPIOLCDDisplay::send(uint8_t value, bool rs) {
   this->rs_pin_->digital_write(rs);
 
   if (this->is_four_bit_mode()) {
-    this->write_n_bits(value >> 4, 4);
+    // the instruction only executes after the low nibble, so the high one needs no execution delay
+    this->pulse_n_bits_(value >> 4, 4);
+    delayMicroseconds(1);  // enable cycle time >1µs
     this->write_n_bits(value, 4);
   } else {
     this->write_n_bits(value, 8);
@@ -18,6 +18,11 @@ class LCDDisplay;
 
 using lcd_writer_t = std::function<void(LCDDisplay &)>;
 
+/** Base class for HD44780 character LCDs.
+ *
+ * The writer draws into a buffer, display() then compares that to a shadow copy of what the panel shows and only
+ * sends the characters that changed, moving the DDRAM address only where a run of changes starts.
+ */
 class LCDDisplay : public PollingComponent {
  public:
   LCDDisplay(uint8_t columns, uint8_t rows, uint32_t update_interval = 1000);
@@ -29,6 +34,16 @@ class LCDDisplay : public PollingComponent {
   void update() override;
   void display();
 
+  /** Print a custom 5x8 glyph at the specified column and row.
+   *
+   * The panel can only hold 8 custom characters. Glyphs are loaded into CGRAM as they are used and the
+   * least recently used one is replaced when all 8 are taken; at most 8 different glyphs can be shown
+   * in the same update.
+   *
+   * @param glyph 8 rows of pixels, top to bottom, using the lower 5 bits of each byte.
+   */
+  void print_glyph(uint8_t column, uint8_t row, const uint8_t *glyph);
+
   /// Print the given text at the specified column and row.
   void print(uint8_t column, uint8_t row, const char *str);
   /// Print the given string at the specified column and row.
@@ -56,10 +71,24 @@ class LCDDisplay : public PollingComponent {
   virtual void send(uint8_t value, bool rs) = 0;
 
   void command_(uint8_t value);
+  void upload_glyphs_();
+
+  struct CustomChar {
+    uint8_t glyph[8];
+    /// The update this character was last used in.
+    uint32_t last_used;
+    bool used;
+    /// Whether the glyph still has to be written to CGRAM.
+    bool dirty;
+  };
 
   uint8_t columns_;
   uint8_t rows_;
   uint8_t *buffer_{nullptr};
+  /// What the panel currently shows.
+  uint8_t *shadow_{nullptr};
+  CustomChar custom_chars_[8]{};
+  uint32_t update_count_{0};
   lcd_writer_t writer_;
 };
 
@@ -81,6 +110,7 @@ class GPIOLCDDisplay : public LCDDisplay {
   bool is_four_bit_mode() override;
   void write_n_bits(uint8_t value, uint8_t n) override;
   void send(uint8_t value, bool rs) override;
+  void pulse_n_bits_(uint8_t value, uint8_t n);
   GPIOPin *rs_pin_{nullptr};
   GPIOPin *rw_pin_{nullptr};
   GPIOPin *enable_pin_{nullptr};
@@ -16,6 +16,8 @@ static const uint8_t MAX7219_REGISTER_INTENSITY = 0x0A;
 static const uint8_t MAX7219_REGISTER_SCAN_LIMIT = 0x0B;
 static const uint8_t MAX7219_REGISTER_SHUTDOWN = 0x0C;
 static const uint8_t MAX7219_UNKNOWN_CHAR = 0b11111111;
+/// Limit the scroller to 50 frames per second.
+static const uint32_t MAX7219_MIN_SCROLL_INTERVAL = 20;
 
 const uint8_t MAX7219_ASCII_TO_RAW[94] PROGMEM = {
     0b00000000,            // ' ', ord 0x20
@@ -122,8 +124,16 @@ void MAX7219Component::setup() {
   ESP_LOGCONFIG(TAG, "Setting up MAX7219...");
   this->spi_setup();
   this->buffer_ = new uint8_t[this->num_chips_ * 8];
-  for (uint8_t i = 0; i < this->num_chips_ * 8; i++)
+  this->shadow_ = new uint8_t[this->num_chips_ * 8];
+  for (uint8_t i = 0; i < this->num_chips_ * 8; i++) {
     this->buffer_[i] = 0;
+    // the digit registers are undefined after power up, make sure the first display() writes all of them
+    this->shadow_[i] = 0xFF;
+  }
+  if (this->matrix_width_ != 0) {
+    this->matrix_ = new uint8_t[this->matrix_width_];
+    memset(this->matrix_, 0, this->matrix_width_);
+  }
 
   // let's assume the user has all 8 digits connected, only important in daisy chained setups anyway
   this->send_to_all_(MAX7219_REGISTER_SCAN_LIMIT, 7);
@@ -133,24 +143,69 @@ void MAX7219Component::setup() {
   this->display();
   // power up
   this->send_to_all_(MAX7219_REGISTER_SHUTDOWN, 1);
+
+  if (this->matrix_ != nullptr && this->scroll_interval_ != 0) {
+    this->set_interval("scroll", std::max(this->scroll_interval_, MAX7219_MIN_SCROLL_INTERVAL),
+                       [this]() { this->scroll_(); });
+  }
 }
 void MAX7219Component::dump_config() {
   ESP_LOGCONFIG(TAG, "MAX7219:");
   ESP_LOGCONFIG(TAG, "  Number of Chips: %u", this->num_chips_);
   ESP_LOGCONFIG(TAG, "  Intensity: %u", this->intensity_);
+  if (this->matrix_width_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Matrix Width: %u", this->matrix_width_);
+    ESP_LOGCONFIG(TAG, "  Scroll Interval: %u ms", this->scroll_interval_);
+  }
   LOG_PIN("  CS Pin: ", this->cs_);
   LOG_UPDATE_INTERVAL(this);
 }
 
 void MAX7219Component::display() {
   for (uint8_t i = 0; i < 8; i++) {
+    bool changed = false;
+    for (uint8_t j = 0; j < this->num_chips_ && !changed; j++)
+      changed = this->buffer_[j * 8 + i] != this->shadow_[j * 8 + i];
+    if (!changed)
+      continue;
+
+    // every chip in the chain latches its register on the same CS edge, chips that are already
+    // showing the right data get a no-op instead.
     this->enable();
     for (uint8_t j = 0; j < this->num_chips_; j++) {
-      this->send_byte_(8 - i, this->buffer_[j * 8 + i]);
+      const uint8_t data = this->buffer_[j * 8 + i];
+      if (data == this->shadow_[j * 8 + i]) {
+        this->send_byte_(MAX7219_REGISTER_NOOP, 0);
+      } else {
+        this->send_byte_(8 - i, data);
+        this->shadow_[j * 8 + i] = data;
+      }
     }
     this->disable();
   }
 }
+void MAX7219Component::render_matrix_() {
+  const uint16_t visible = this->num_chips_ * 8;
+  for (uint8_t chip = 0; chip < this->num_chips_; chip++) {
+    for (uint8_t y = 0; y < 8; y++) {
+      uint8_t row = 0;
+      for (uint8_t bit = 0; bit < 8; bit++) {
+        uint16_t x = this->scroll_offset_ + chip * 8 + bit;
+        // buffers wider than the display wrap around, narrower ones are padded with blank columns
+        if (this->matrix_width_ > visible)
+          x %= this->matrix_width_;
+        if (x < this->matrix_width_ && (this->matrix_[x] & (1 << y)))
+          row |= 0x80 >> bit;
+      }
+      this->buffer_[chip * 8 + y] = row;
+    }
+  }
+}
+void MAX7219Component::scroll_() {
+  this->scroll_offset_ = (this->scroll_offset_ + 1) % this->matrix_width_;
+  this->render_matrix_();
+  this->display();
+}
 void MAX7219Component::send_byte_(uint8_t a_register, uint8_t data) {
   this->write_byte(a_register);
   this->write_byte(data);
@@ -163,12 +218,34 @@ void MAX7219Component::send_to_all_(uint8_t a_register, uint8_t data) {
 }
 bool MAX7219Component::is_device_msb_first() { return true; }
 void MAX7219Component::update() {
+  if (this->matrix_ != nullptr) {
+    memset(this->matrix_, 0, this->matrix_width_);
+    if (this->writer_.has_value())
+      (*this->writer_)(*this);
+    this->render_matrix_();
+    this->display();
+    return;
+  }
+
   for (uint8_t i = 0; i < this->num_chips_ * 8; i++)
     this->buffer_[i] = 0;
   if (this->writer_.has_value())
     (*this->writer_)(*this);
   this->display();
 }
+void MAX7219Component::matrix_pixel(uint16_t x, uint8_t y, bool on) {
+  if (x >= this->matrix_width_ || y >= 8)
+    return;
+  if (on)
+    this->matrix_[x] |= 1 << y;
+  else
+    this->matrix_[x] &= ~(1 << y);
+}
+void MAX7219Component::matrix_column(uint16_t x, uint8_t column) {
+  if (x >= this->matrix_width_)
+    return;
+  this->matrix_[x] = column;
+}
 uint8_t MAX7219Component::print(uint8_t start_pos, const char *str) {
   uint8_t pos = start_pos;
   for (; *str != '\0'; str++) {
@@ -218,6 +295,11 @@ uint8_t MAX7219Component::printf(const char *format, ...) {
 void MAX7219Component::set_writer(max7219_writer_t &&writer) { this->writer_ = writer; }
 void MAX7219Component::set_intensity(uint8_t intensity) { this->intensity_ = intensity; }
 void MAX7219Component::set_num_chips(uint8_t num_chips) { this->num_chips_ = num_chips; }
+void MAX7219Component::set_matrix_width(uint16_t matrix_width) { this->matrix_width_ = matrix_width; }
+void MAX7219Component::set_scroll_interval(uint32_t scroll_interval) { this->scroll_interval_ = scroll_interval; }
+void MAX7219Component::set_scroll_offset(uint16_t scroll_offset) {
+  this->scroll_offset_ = this->matrix_width_ != 0 ? scroll_offset % this->matrix_width_ : 0;
+}
 
 #ifdef USE_TIME
 uint8_t MAX7219Component::strftime(uint8_t pos, const char *format, time::ESPTime time) {
@@ -38,6 +38,21 @@ class MAX7219Component : public PollingComponent, public SPIDevice {
   void set_intensity(uint8_t intensity);
   void set_num_chips(uint8_t num_chips);
 
+  /** Use the chips as a LED matrix, with an off-screen buffer of the given width in pixels.
+   *
+   * The writer then draws with matrix_pixel()/matrix_column() instead of print(). The chain shows
+   * num_chips * 8 columns of that buffer, starting at the scroll offset.
+   */
+  void set_matrix_width(uint16_t matrix_width);
+  /// Scroll the matrix one column every scroll_interval ms, independently of update(). 0 disables scrolling.
+  void set_scroll_interval(uint32_t scroll_interval);
+  /// Set the first matrix column shown on the display, takes effect with the next update or scroll step.
+  void set_scroll_offset(uint16_t scroll_offset);
+  /// Set a single pixel of the matrix buffer.
+  void matrix_pixel(uint16_t x, uint8_t y, bool on);
+  /// Set a whole column of the matrix buffer, bit 0 is the top row.
+  void matrix_column(uint16_t x, uint8_t column);
+
   /// Evaluate the printf-format and print the result at the given position.
   uint8_t printf(uint8_t pos, const char *format, ...) __attribute__((format(printf, 3, 4)));
   /// Evaluate the printf-format and print the result at position 0.
@@ -60,10 +75,19 @@ class MAX7219Component : public PollingComponent, public SPIDevice {
   void send_byte_(uint8_t a_register, uint8_t data);
   void send_to_all_(uint8_t a_register, uint8_t data);
   bool is_device_msb_first() override;
+  /// Copy the visible window of the matrix buffer into the digit registers.
+  void render_matrix_();
+  void scroll_();
 
   uint8_t intensity_{15};  /// Intensity of the display from 0 to 15 (most)
   uint8_t num_chips_{1};
   uint8_t *buffer_;
+  /// The digit registers as the chips currently have them.
+  uint8_t *shadow_;
+  uint8_t *matrix_{nullptr};
+  uint16_t matrix_width_{0};
+  uint16_t scroll_offset_{0};
+  uint32_t scroll_interval_{0};
   optional<max7219_writer_t> writer_{};
 };
 
@@ -11,6 +11,11 @@ namespace display {
 
 static const char *TAG = "display.nextion";
 
+static const uint32_t NEXTION_ACK_TIMEOUT = 100;
+static const size_t NEXTION_MAX_QUEUED_COMMANDS = 64;
+/// Keep each UART write within the hardware TX FIFO so that writing a batch doesn't block.
+static const size_t NEXTION_MAX_BATCH_LENGTH = 128;
+
 void Nextion::setup() {
   this->send_command_no_ack("");
   this->send_command_printf("bkcmd=3");
@@ -22,55 +27,88 @@ void Nextion::update() {
     (*this->writer_)(*this);
   }
 }
-void Nextion::send_command_no_ack(const char *command) {
-  // Flush RX...
-  this->loop();
+void Nextion::send_command_no_ack(const char *command) { this->queue_command_(command, false); }
+bool Nextion::queue_command_(std::string command, bool ack) {
+  if (this->queue_.size() >= NEXTION_MAX_QUEUED_COMMANDS) {
+    ESP_LOGW(TAG, "Command queue is full, dropping '%s'!", command.c_str());
+    return false;
+  }
+  this->queue_.push(NextionCommand{std::move(command), ack});
+  return true;
+}
+bool Nextion::set_attribute_(const char *component, const char *attribute, const std::string &value) {
+  std::string key = std::string(component) + "." + attribute;
+  auto it = this->attributes_.find(key);
+  if (it != this->attributes_.end() && it->second == value)
+    return true;
 
-  this->write_str(command);
-  const uint8_t data[3] = {0xFF, 0xFF, 0xFF};
-  this->write_array(data, sizeof(data));
+  // a dropped command isn't cached, so it's sent again the next time the attribute is set
+  if (!this->queue_command_(key + "=" + value, true))
+    return false;
+  this->attributes_[key] = value;
+  return true;
 }
+void Nextion::send_queued_() {
+  std::string batch;
+  while (!this->queue_.empty()) {
+    const NextionCommand &command = this->queue_.front();
+    const bool ack = command.ack && this->wait_for_ack_;
+    if (ack && this->in_flight_ >= this->max_in_flight_)
+      break;
+    if (!batch.empty() && batch.size() + command.command.size() + 3 > NEXTION_MAX_BATCH_LENGTH)
+      break;
 
-bool Nextion::ack_() {
-  if (!this->wait_for_ack_)
-    return true;
+    batch += command.command;
+    batch.append(3, '\xFF');
+    if (ack)
+      this->in_flight_++;
+    this->queue_.pop();
+  }
 
-  uint32_t start = millis();
-  while (!this->read_until_ack_()) {
-    if (millis() - start > 100) {
-      ESP_LOGW(TAG, "Waiting for ACK timed out!");
-      return false;
-    }
+  if (batch.empty())
+    return;
+  this->write_array(reinterpret_cast<const uint8_t *>(batch.data()), batch.size());
+  this->last_progress_ = millis();
+}
+void Nextion::on_response_(bool success) {
+  if (this->in_flight_ != 0)
+    this->in_flight_--;
+  this->last_progress_ = millis();
+  if (!success) {
+    // we don't know which command failed, so don't trust any cached attribute
+    this->attributes_.clear();
   }
-  return true;
 }
 void Nextion::set_component_text(const char *component, const char *text) {
-  this->send_command_printf("%s.txt=\"%s\"", component, text);
+  this->set_attribute_(component, "txt", std::string("\"") + text + "\"");
 }
 void Nextion::set_component_value(const char *component, int value) {
-  this->send_command_printf("%s.val=%d", component, value);
+  this->set_attribute_(component, "val", to_string(value));
+}
+void Nextion::set_component_picture(const char *component, const char *picture) {
+  this->set_attribute_(component, "pic", picture);
 }
 void Nextion::display_picture(int picture_id, int x_start, int y_start) {
   this->send_command_printf("pic %d %d %d", picture_id, x_start, y_start);
 }
 void Nextion::set_component_background_color(const char *component, const char *color) {
-  this->send_command_printf("%s.bco=\"%s\"", component, color);
+  this->set_attribute_(component, "bco", std::string("\"") + color + "\"");
 }
 void Nextion::set_component_pressed_background_color(const char *component, const char *color) {
-  this->send_command_printf("%s.bco2=\"%s\"", component, color);
+  this->set_attribute_(component, "bco2", std::string("\"") + color + "\"");
 }
 void Nextion::set_component_font_color(const char *component, const char *color) {
-  this->send_command_printf("%s.pco=\"%s\"", component, color);
+  this->set_attribute_(component, "pco", std::string("\"") + color + "\"");
 }
 void Nextion::set_component_pressed_font_color(const char *component, const char *color) {
-  this->send_command_printf("%s.pco2=\"%s\"", component, color);
+  this->set_attribute_(component, "pco2", std::string("\"") + color + "\"");
 }
 void Nextion::set_component_coordinates(const char *component, int x, int y) {
-  this->send_command_printf("%s.xcen=%d", component, x);
-  this->send_command_printf("%s.ycen=%d", component, y);
+  this->set_attribute_(component, "xcen", to_string(x));
+  this->set_attribute_(component, "ycen", to_string(y));
 }
 void Nextion::set_component_font(const char *component, uint8_t font_id) {
-  this->send_command_printf("%s.font=%d", component, font_id);
+  this->set_attribute_(component, "font", to_string(font_id));
 }
 void Nextion::goto_page(const char *page) { this->send_command_printf("page %s", page); }
 bool Nextion::send_command_printf(const char *format, ...) {
@@ -83,13 +121,10 @@ bool Nextion::send_command_printf(const char *format, ...) {
     ESP_LOGW(TAG, "Building command for format '%s' failed!", format);
     return false;
   }
-  this->send_command_no_ack(buffer);
-  if (!this->ack_()) {
-    ESP_LOGW(TAG, "Sending command '%s' failed because no ACK was received", buffer);
-    return false;
-  }
-
-  return true;
+  // loading a page resets its components to their defaults
+  if (strncmp(buffer, "page ", 5) == 0)
+    this->attributes_.clear();
+  return this->queue_command_(buffer, true);
 }
 void Nextion::hide_component(const char *component) { this->send_command_printf("vis %s,0", component); }
 void Nextion::show_component(const char *component) { this->send_command_printf("vis %s,1", component); }
@@ -113,7 +148,7 @@ void Nextion::circle(int center_x, int center_y, int radius, const char *color)
 void Nextion::filled_circle(int center_x, int center_y, int radius, const char *color) {
   this->send_command_printf("cirs %d,%d,%d,%s", center_x, center_y, radius, color);
 }
-bool Nextion::read_until_ack_() {
+void Nextion::read_events_() {
   while (this->available() >= 4) {
     // flush preceding filler bytes
     uint8_t temp;
@@ -155,7 +190,7 @@ bool Nextion::read_until_ack_() {
     bool invalid_data_length = false;
     switch (event) {
       case 0x01:  // successful execution of instruction (ACK)
-        return true;
+        break;
       case 0x00:  // invalid instruction
         ESP_LOGW(TAG, "Nextion reported invalid instruction!");
         break;
@@ -214,6 +249,8 @@ bool Nextion::read_until_ack_() {
         for (auto *touch : this->touch_) {
           touch->process(page_id, component_id, touch_event);
         }
+        // the touch may have run display side code that changed the page or component attributes
+        this->attributes_.clear();
         break;
       }
       case 0x67:
@@ -228,12 +265,18 @@ bool Nextion::read_until_ack_() {
         ESP_LOGD(TAG, "Got touch at x=%u y=%u type=%s", x, y, touch_event ? "PRESS" : "RELEASE");
         break;
       }
-      case 0x66:  // sendme page id
+      case 0x88:  // system successful start up
+        // the display (re)started, nothing we sent before is on it anymore
+        this->in_flight_ = 0;
+        this->attributes_.clear();
+        break;
+      case 0x66:  // sendme page id, sent after the page changed if sendme is enabled
+        this->attributes_.clear();
+        break;
       case 0x70:  // string variable data return
       case 0x71:  // numeric variable data return
       case 0x86:  // device automatically enters into sleep mode
       case 0x87:  // device automatically wakes up
-      case 0x88:  // system successful start up
       case 0x89:  // start SD card upgrade
       case 0xFD:  // data transparent transmit finished
       case 0xFE:  // data transparent transmit ready
@@ -245,14 +288,21 @@ bool Nextion::read_until_ack_() {
     if (invalid_data_length) {
       ESP_LOGW(TAG, "Invalid data length from nextion!");
     }
+    // all events below 0x24 are the result of an instruction, in the order they were sent
+    if (event < 0x24)
+      this->on_response_(event == 0x01);
   }
-
-  return false;
 }
 void Nextion::loop() {
-  while (this->available() >= 4) {
-    this->read_until_ack_();
+  this->read_events_();
+
+  if (this->in_flight_ != 0 && millis() - this->last_progress_ > NEXTION_ACK_TIMEOUT) {
+    ESP_LOGW(TAG, "Waiting for ACK timed out!");
+    this->in_flight_ = 0;
+    this->attributes_.clear();
   }
+
+  this->send_queued_();
 }
 #ifdef USE_TIME
 void Nextion::set_nextion_rtc_time(time::ESPTime time) {
@@ -286,6 +336,7 @@ void Nextion::set_component_text_printf(const char *component, const char *forma
     this->set_component_text(component, buffer);
 }
 void Nextion::set_wait_for_ack(bool wait_for_ack) { this->wait_for_ack_ = wait_for_ack; }
+void Nextion::set_max_in_flight(uint8_t max_in_flight) { this->max_in_flight_ = std::max(max_in_flight, uint8_t(1)); }
 
 void NextionTouchComponent::process(uint8_t page_id, uint8_t component_id, bool on) {
   if (this->page_id_ == page_id && this->component_id_ == component_id) {
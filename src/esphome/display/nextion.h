@@ -5,6 +5,8 @@
 
 #ifdef USE_NEXTION
 
+#include <queue>
+#include <unordered_map>
 #include "esphome/component.h"
 #include "esphome/uart_component.h"
 #include "esphome/time/rtc_component.h"
@@ -19,6 +21,17 @@ class Nextion;
 
 using nextion_writer_t = std::function<void(Nextion &)>;
 
+/** Driver for Nextion HMI displays.
+ *
+ * Commands are not sent immediately, they're appended to a queue that is written out in loop(). Up to
+ * max_in_flight commands are written to the UART in a single write and their ACKs are consumed as they
+ * arrive, so the caller never waits for a round trip to the display.
+ *
+ * Component attributes (text, value, colors, ...) are additionally cached: setting an attribute to the value
+ * it already has on the display doesn't send anything. The cache is cleared when the page changes (a "page"
+ * command, a sendme page event or a touch event, which can run page changing code on the display), since the
+ * Nextion resets components when a page is loaded, and when the display reports an error.
+ */
 class Nextion : public PollingComponent, public UARTDevice {
  public:
   /**
@@ -204,19 +217,43 @@ class Nextion : public PollingComponent, public UARTDevice {
    * Manually send a raw formatted command to the display.
    * @param format The printf-style command format, like "vis %s,0"
    * @param ... The format arguments
-   * @return Whether the send was successful.
+   * @return Whether the command could be queued.
    */
   bool send_command_printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
 
   void set_wait_for_ack(bool wait_for_ack);
+  /** Set how many commands may be waiting for an ACK at once.
+   *
+   * All commands that fit are batched into a single UART write. Set to 1 to send one command per write
+   * and wait for its ACK before sending the next one.
+   */
+  void set_max_in_flight(uint8_t max_in_flight);
 
  protected:
-  bool ack_();
-  bool read_until_ack_();
+  struct NextionCommand {
+    std::string command;
+    bool ack;
+  };
+
+  bool queue_command_(std::string command, bool ack);
+  /// Set "component.attribute" to value (the raw right hand side), unless the display already shows that.
+  bool set_attribute_(const char *component, const char *attribute, const std::string &value);
+  void send_queued_();
+  void read_events_();
+  /// Called for every response to a command, success or error.
+  void on_response_(bool success);
 
   std::vector<NextionTouchComponent *> touch_;
   optional<nextion_writer_t> writer_;
   bool wait_for_ack_{true};
+  uint8_t max_in_flight_{8};
+  std::queue<NextionCommand> queue_;
+  /// How many sent commands are still waiting for a response.
+  uint8_t in_flight_{0};
+  /// When a command was last sent or answered, for the ACK timeout.
+  uint32_t last_progress_{0};
+  /// The last value sent for each "component.attribute".
+  std::unordered_map<std::string, std::string> attributes_;
 };
 
 class NextionTouchComponent : public binary_sensor::BinarySensor {
@@ -0,0 +1,281 @@
+#include "esphome/defines.h"
+
+#ifdef USE_SPI_TFT
+
+#include "esphome/display/spi_tft.h"
+#include "esphome/log.h"
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace display {
+
+static const char *TAG = "display.spi_tft";
+
+static const uint8_t SPI_TFT_COMMAND_SWRESET = 0x01;
+static const uint8_t SPI_TFT_COMMAND_SLPOUT = 0x11;
+static const uint8_t SPI_TFT_COMMAND_NORON = 0x13;
+static const uint8_t SPI_TFT_COMMAND_INVOFF = 0x20;
+static const uint8_t SPI_TFT_COMMAND_GAMMASET = 0x26;
+static const uint8_t SPI_TFT_COMMAND_DISPON = 0x29;
+static const uint8_t SPI_TFT_COMMAND_CASET = 0x2A;
+static const uint8_t SPI_TFT_COMMAND_RASET = 0x2B;
+static const uint8_t SPI_TFT_COMMAND_RAMWR = 0x2C;
+static const uint8_t SPI_TFT_COMMAND_MADCTL = 0x36;
+static const uint8_t SPI_TFT_COMMAND_VSCRSADD = 0x37;
+static const uint8_t SPI_TFT_COMMAND_COLMOD = 0x3A;
+static const uint8_t SPI_TFT_COMMAND_FRMCTR1 = 0xB1;
+static const uint8_t SPI_TFT_COMMAND_FRMCTR2 = 0xB2;
+static const uint8_t SPI_TFT_COMMAND_FRMCTR3 = 0xB3;
+static const uint8_t SPI_TFT_COMMAND_INVCTR = 0xB4;
+static const uint8_t SPI_TFT_COMMAND_DFUNCTR = 0xB6;
+static const uint8_t SPI_TFT_COMMAND_PWCTR1 = 0xC0;
+static const uint8_t SPI_TFT_COMMAND_PWCTR2 = 0xC1;
+static const uint8_t SPI_TFT_COMMAND_PWCTR3 = 0xC2;
+static const uint8_t SPI_TFT_COMMAND_PWCTR4 = 0xC3;
+static const uint8_t SPI_TFT_COMMAND_PWCTR5 = 0xC4;
+static const uint8_t SPI_TFT_COMMAND_VMCTR1 = 0xC5;
+static const uint8_t SPI_TFT_COMMAND_VMCTR2 = 0xC7;
+static const uint8_t SPI_TFT_COMMAND_GMCTRP1 = 0xE0;
+static const uint8_t SPI_TFT_COMMAND_GMCTRN1 = 0xE1;
+
+/// Set on the argument count of an init sequence entry to wait afterwards.
+static const uint8_t SPI_TFT_DELAY = 0x80;
+
+// clang-format off
+static const uint8_t ST7735_INIT_SEQUENCE[] PROGMEM = {
+    SPI_TFT_COMMAND_SWRESET, SPI_TFT_DELAY, 150,
+    SPI_TFT_COMMAND_SLPOUT, SPI_TFT_DELAY, 255,
+    SPI_TFT_COMMAND_FRMCTR1, 3, 0x01, 0x2C, 0x2D,
+    SPI_TFT_COMMAND_FRMCTR2, 3, 0x01, 0x2C, 0x2D,
+    SPI_TFT_COMMAND_FRMCTR3, 6, 0x01, 0x2C, 0x2D, 0x01, 0x2C, 0x2D,
+    SPI_TFT_COMMAND_INVCTR, 1, 0x07,
+    SPI_TFT_COMMAND_PWCTR1, 3, 0xA2, 0x02, 0x84,
+    SPI_TFT_COMMAND_PWCTR2, 1, 0xC5,
+    SPI_TFT_COMMAND_PWCTR3, 2, 0x0A, 0x00,
+    SPI_TFT_COMMAND_PWCTR4, 2, 0x8A, 0x2A,
+    SPI_TFT_COMMAND_PWCTR5, 2, 0x8A, 0xEE,
+    SPI_TFT_COMMAND_VMCTR1, 1, 0x0E,
+    SPI_TFT_COMMAND_INVOFF, 0,
+    SPI_TFT_COMMAND_MADCTL, 1, 0xC8,  // row/column address order for a portrait panel, BGR
+    SPI_TFT_COMMAND_COLMOD, 1, 0x05,  // 16 bits per pixel
+    SPI_TFT_COMMAND_GMCTRP1, 16, 0x02, 0x1C, 0x07, 0x12, 0x37, 0x32, 0x29, 0x2D,
+                                 0x29, 0x25, 0x2B, 0x39, 0x00, 0x01, 0x03, 0x10,
+    SPI_TFT_COMMAND_GMCTRN1, 16, 0x03, 0x1D, 0x07, 0x06, 0x2E, 0x2C, 0x29, 0x2D,
+                                 0x2E, 0x2E, 0x37, 0x3F, 0x00, 0x00, 0x02, 0x10,
+    SPI_TFT_COMMAND_NORON, SPI_TFT_DELAY, 10,
+    SPI_TFT_COMMAND_DISPON, SPI_TFT_DELAY, 100,
+    0x00,  // end
+};
+
+static const uint8_t ILI9341_INIT_SEQUENCE[] PROGMEM = {
+    SPI_TFT_COMMAND_SWRESET, SPI_TFT_DELAY, 150,
+    0xEF, 3, 0x03, 0x80, 0x02,
+    0xCF, 3, 0x00, 0xC1, 0x30,
+    0xED, 4, 0x64, 0x03, 0x12, 0x81,
+    0xE8, 3, 0x85, 0x00, 0x78,
+    0xCB, 5, 0x39, 0x2C, 0x00, 0x34, 0x02,
+    0xF7, 1, 0x20,
+    0xEA, 2, 0x00, 0x00,
+    SPI_TFT_COMMAND_PWCTR1, 1, 0x23,
+    SPI_TFT_COMMAND_PWCTR2, 1, 0x10,
+    SPI_TFT_COMMAND_VMCTR1, 2, 0x3E, 0x28,
+    SPI_TFT_COMMAND_VMCTR2, 1, 0x86,
+    SPI_TFT_COMMAND_MADCTL, 1, 0x48,  // column address order for a portrait panel, BGR
+    SPI_TFT_COMMAND_VSCRSADD, 1, 0x00,
+    SPI_TFT_COMMAND_COLMOD, 1, 0x55,  // 16 bits per pixel
+    SPI_TFT_COMMAND_FRMCTR1, 2, 0x00, 0x18,
+    SPI_TFT_COMMAND_DFUNCTR, 3, 0x08, 0x82, 0x27,
+    0xF2, 1, 0x00,
+    SPI_TFT_COMMAND_GAMMASET, 1, 0x01,
+    SPI_TFT_COMMAND_GMCTRP1, 15, 0x0F, 0x31, 0x2B, 0x0C, 0x0E, 0x08, 0x4E, 0xF1,
+                                 0x37, 0x07, 0x10, 0x03, 0x0E, 0x09, 0x00,
+    SPI_TFT_COMMAND_GMCTRN1, 15, 0x00, 0x0E, 0x14, 0x03, 0x11, 0x07, 0x31, 0xC1,
+                                 0x48, 0x08, 0x0F, 0x0C, 0x31, 0x36, 0x0F,
+    SPI_TFT_COMMAND_SLPOUT, SPI_TFT_DELAY, 150,
+    SPI_TFT_COMMAND_DISPON, SPI_TFT_DELAY, 150,
+    0x00,  // end
+};
+// clang-format on
+
+SPITFT::SPITFT(SPIComponent *parent, GPIOPin *cs, GPIOPin *dc_pin, uint32_t update_interval)
+    : PollingComponent(update_interval), SPIDevice(parent, cs), dc_pin_(dc_pin) {}
+void SPITFT::set_reset_pin(const GPIOOutputPin &reset) { this->reset_pin_ = reset.copy(); }
+void SPITFT::set_band_height(uint16_t band_height) { this->band_height_ = band_height; }
+void SPITFT::set_offsets(uint8_t x_offset, uint8_t y_offset) {
+  this->x_offset_ = x_offset;
+  this->y_offset_ = y_offset;
+}
+float SPITFT::get_setup_priority() const { return setup_priority::POST_HARDWARE; }
+bool SPITFT::is_color_internal() { return true; }
+bool SPITFT::is_device_msb_first() { return true; }
+bool SPITFT::is_device_high_speed() { return true; }
+void SPITFT::setup() {
+  this->dc_pin_->setup();  // OUTPUT
+  this->dc_pin_->digital_write(false);
+  this->spi_setup();
+
+  if (this->reset_pin_ != nullptr) {
+    this->reset_pin_->setup();  // OUTPUT
+    this->reset_pin_->digital_write(false);
+    delay(10);
+    this->reset_pin_->digital_write(true);
+    delay(120);
+  }
+
+  if (this->band_height_ == 0 || this->band_height_ > this->get_height_internal())
+    this->band_height_ = this->get_height_internal();
+  // the first band, until update() selects one
+  this->band_end_ = this->band_height_;
+  this->init_internal_(this->get_width_internal() * this->band_height_ * 2u);
+  if (this->buffer_ == nullptr) {
+    this->mark_failed();
+    return;
+  }
+
+  this->send_init_sequence_(this->get_init_sequence_());
+}
+void SPITFT::update() {
+  const int height = this->get_height_internal();
+  for (int y = 0; y < height; y += this->band_height_) {
+    const int end = std::min(y + int(this->band_height_), height);
+    this->do_update_band_(y, end);
+    if (this->is_frame_skipped_())
+      return;
+    this->write_band_(y, end);
+  }
+}
+void SPITFT::loop() {
+  if (!this->should_render_frame_())
+    return;
+  const uint32_t start = micros();
+  this->update();
+  this->frame_rendered_(micros() - start);
+}
+void SPITFT::fill(int color) {
+  if (this->is_clipped_()) {
+    DisplayBuffer::fill(color);
+    return;
+  }
+  const uint16_t color565 = color_to_rgb565(color);
+  const uint8_t high = color565 >> 8, low = color565;
+  const uint32_t length = this->get_width_internal() * this->band_height_ * 2u;
+  for (uint32_t i = 0; i < length; i += 2) {
+    this->buffer_[i] = high;
+    this->buffer_[i + 1] = low;
+  }
+}
+void HOT SPITFT::draw_absolute_pixel_internal(int x, int y, int color) {
+  const int row = y - this->band_start_;
+  if (x >= this->get_width_internal() || x < 0 || row >= this->band_height_ || row < 0)
+    return;
+
+  const uint16_t color565 = color_to_rgb565(color);
+  const uint32_t pos = (uint32_t(row) * this->get_width_internal() + x) * 2u;
+  this->buffer_[pos] = color565 >> 8;
+  this->buffer_[pos + 1] = color565;
+}
+int SPITFT::get_absolute_pixel_internal(int x, int y) {
+  const int row = y - this->band_start_;
+  if (x >= this->get_width_internal() || x < 0 || row >= this->band_height_ || row < 0)
+    return COLOR_OFF;
+
+  const uint32_t pos = (uint32_t(row) * this->get_width_internal() + x) * 2u;
+  return rgb565_to_color((this->buffer_[pos] << 8) | this->buffer_[pos + 1]);
+}
+void SPITFT::command_(uint8_t value) {
+  this->dc_pin_->digital_write(false);
+  this->enable();
+  this->write_byte(value);
+  this->disable();
+}
+void SPITFT::send_init_sequence_(const uint8_t *sequence) {
+  while (true) {
+    const uint8_t command = pgm_read_byte(sequence++);
+    if (command == 0x00)
+      break;
+    const uint8_t num_args = pgm_read_byte(sequence++);
+
+    this->command_(command);
+    if ((num_args & ~SPI_TFT_DELAY) != 0) {
+      this->dc_pin_->digital_write(true);
+      this->enable();
+      for (uint8_t i = 0; i < (num_args & ~SPI_TFT_DELAY); i++)
+        this->write_byte(pgm_read_byte(sequence++));
+      this->disable();
+    }
+    if (num_args & SPI_TFT_DELAY)
+      delay(pgm_read_byte(sequence++));
+  }
+}
+void SPITFT::set_address_window_(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+  x1 += this->x_offset_;
+  x2 += this->x_offset_;
+  y1 += this->y_offset_;
+  y2 += this->y_offset_;
+
+  uint8_t column[4] = {uint8_t(x1 >> 8), uint8_t(x1), uint8_t(x2 >> 8), uint8_t(x2)};
+  this->command_(SPI_TFT_COMMAND_CASET);
+  this->dc_pin_->digital_write(true);
+  this->enable();
+  this->write_array(column, sizeof(column));
+  this->disable();
+
+  uint8_t row[4] = {uint8_t(y1 >> 8), uint8_t(y1), uint8_t(y2 >> 8), uint8_t(y2)};
+  this->command_(SPI_TFT_COMMAND_RASET);
+  this->dc_pin_->digital_write(true);
+  this->enable();
+  this->write_array(row, sizeof(row));
+  this->disable();
+}
+void HOT SPITFT::write_band_(int y_start, int y_end) {
+  const int width = this->get_width_internal();
+  this->set_address_window_(0, y_start, width - 1, y_end - 1);
+  this->command_(SPI_TFT_COMMAND_RAMWR);
+
+  // the rows are contiguous in the buffer and in the address window, send them in one go
+  this->dc_pin_->digital_write(true);
+  this->enable();
+  this->write_array(this->buffer_, uint32_t(y_end - y_start) * width * 2u);
+  this->disable();
+}
+void SPITFT::dump_config_tft_() {
+  if (this->band_height_ < this->get_height_internal()) {
+    ESP_LOGCONFIG(TAG, "  Band Height: %u rows", this->band_height_);
+  }
+  if (this->x_offset_ != 0 || this->y_offset_ != 0) {
+    ESP_LOGCONFIG(TAG, "  Offsets: x=%u y=%u", this->x_offset_, this->y_offset_);
+  }
+  LOG_PIN("  CS Pin: ", this->cs_);
+  LOG_PIN("  DC Pin: ", this->dc_pin_);
+  LOG_PIN("  Reset Pin: ", this->reset_pin_);
+  LOG_UPDATE_INTERVAL(this);
+  if (this->is_failed()) {
+    ESP_LOGE(TAG, "Could not allocate the framebuffer, try a smaller band height!");
+  }
+}
+
+ST7735::ST7735(SPIComponent *parent, GPIOPin *cs, GPIOPin *dc_pin, uint32_t update_interval)
+    : SPITFT(parent, cs, dc_pin, update_interval) {}
+void ST7735::dump_config() {
+  LOG_DISPLAY("", "ST7735", this);
+  this->dump_config_tft_();
+}
+const uint8_t *ST7735::get_init_sequence_() { return ST7735_INIT_SEQUENCE; }
+int ST7735::get_width_internal() { return 128; }
+int ST7735::get_height_internal() { return 160; }
+
+ILI9341::ILI9341(SPIComponent *parent, GPIOPin *cs, GPIOPin *dc_pin, uint32_t update_interval)
+    : SPITFT(parent, cs, dc_pin, update_interval) {}
+void ILI9341::dump_config() {
+  LOG_DISPLAY("", "ILI9341", this);
+  this->dump_config_tft_();
+}
+const uint8_t *ILI9341::get_init_sequence_() { return ILI9341_INIT_SEQUENCE; }
+int ILI9341::get_width_internal() { return 240; }
+int ILI9341::get_height_internal() { return 320; }
+
+}  // namespace display
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_SPI_TFT
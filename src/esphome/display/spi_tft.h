@@ -0,0 +1,89 @@
+#ifndef ESPHOME_DISPLAY_SPI_TFT_H
+#define ESPHOME_DISPLAY_SPI_TFT_H
+
+#include "esphome/defines.h"
+
+#ifdef USE_SPI_TFT
+
+#include "esphome/spi_component.h"
+#include "esphome/display/display.h"
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace display {
+
+/** Base class for RGB565 colour TFTs with an MIPI DCS style command set (ST7735, ILI9341).
+ *
+ * The framebuffer holds RGB565 pixels in the byte order the panel expects, so finished rows are streamed to
+ * the panel with a single write_array() after setting the address window. Displays that don't fit into RAM
+ * are rendered in bands: the writer runs once per band of band_height rows and every band is sent to the
+ * panel before the buffer is reused for the next one.
+ */
+class SPITFT : public PollingComponent, public SPIDevice, public DisplayBuffer {
+ public:
+  SPITFT(SPIComponent *parent, GPIOPin *cs, GPIOPin *dc_pin, uint32_t update_interval);
+  void set_reset_pin(const GPIOOutputPin &reset);
+  /// Render in bands of this many rows. 0 buffers the whole screen at once.
+  void set_band_height(uint16_t band_height);
+  /// Set the position of the visible area in the controller's RAM, some panels don't start at [0,0].
+  void set_offsets(uint8_t x_offset, uint8_t y_offset);
+
+  void setup() override;
+  float get_setup_priority() const override;
+  void update() override;
+  void loop() override;
+  void fill(int color) override;
+
+ protected:
+  /// Return the init sequence: command, number of arguments (|0x80 to delay afterwards), arguments, delay in ms.
+  virtual const uint8_t *get_init_sequence_() = 0;
+
+  void draw_absolute_pixel_internal(int x, int y, int color) override;
+  int get_absolute_pixel_internal(int x, int y) override;
+  bool is_color_internal() override;
+  bool is_device_msb_first() override;
+  bool is_device_high_speed() override;
+
+  void command_(uint8_t value);
+  void send_init_sequence_(const uint8_t *sequence);
+  void set_address_window_(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
+  /// Send the rows [y_start, y_end) from the buffer to the panel.
+  void write_band_(int y_start, int y_end);
+  void dump_config_tft_();
+
+  GPIOPin *dc_pin_;
+  GPIOPin *reset_pin_{nullptr};
+  uint16_t band_height_{16};
+  uint8_t x_offset_{0};
+  uint8_t y_offset_{0};
+};
+
+class ST7735 : public SPITFT {
+ public:
+  ST7735(SPIComponent *parent, GPIOPin *cs, GPIOPin *dc_pin, uint32_t update_interval = 1000);
+  void dump_config() override;
+
+ protected:
+  const uint8_t *get_init_sequence_() override;
+  int get_width_internal() override;
+  int get_height_internal() override;
+};
+
+class ILI9341 : public SPITFT {
+ public:
+  ILI9341(SPIComponent *parent, GPIOPin *cs, GPIOPin *dc_pin, uint32_t update_interval = 1000);
+  void dump_config() override;
+
+ protected:
+  const uint8_t *get_init_sequence_() override;
+  int get_width_internal() override;
+  int get_height_internal() override;
+};
+
+}  // namespace display
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_SPI_TFT
+
+#endif  // ESPHOME_DISPLAY_SPI_TFT_H
@@ -34,6 +34,11 @@ static const uint8_t SSD1306_COMMAND_PAGE_ADDRESS = 0x22;
 static const uint8_t SSD1306_NORMAL_DISPLAY = 0xA6;
 
 void SSD1306::setup() {
+  this->band_height_ &= ~0x07;
+  if (this->band_height_ == 0 || this->band_height_ > this->get_height_internal())
+    this->band_height_ = this->get_height_internal();
+  // the first band, until a frame is rendered
+  this->band_end_ = this->band_height_;
   this->init_internal_(this->get_buffer_length_());
 
   this->command(SSD1306_COMMAND_DISPLAY_OFF);
@@ -132,10 +137,10 @@ void SSD1306::display() {
   }
 
   this->command(SSD1306_COMMAND_PAGE_ADDRESS);
-  // Page start address, 0
-  this->command(0);
+  // Page start address
+  this->command(this->band_start_ / 8);
   // Page end address:
-  this->command((this->get_height_internal() / 8) - 1);
+  this->command(this->band_start_ / 8 + this->get_band_pages_() - 1);
 
   this->write_display_data();
 }
@@ -144,9 +149,22 @@ bool SSD1306::is_sh1106_() const {
          this->model_ == SH1106_MODEL_128_64;
 }
 void SSD1306::update() {
-  this->do_update_();
-  this->display();
+  const int height = this->get_height_internal();
+  for (int y = 0; y < height; y += this->band_height_) {
+    this->do_update_band_(y, std::min(y + int(this->band_height_), height));
+    if (this->is_frame_skipped_())
+      return;
+    this->display();
+  }
+}
+void SSD1306::loop() {
+  if (!this->should_render_frame_())
+    return;
+  const uint32_t start = micros();
+  this->update();
+  this->frame_rendered_(micros() - start);
 }
+void SSD1306::set_band_height(uint8_t band_height) { this->band_height_ = band_height; }
 void SSD1306::set_model(SSD1306Model model) { this->model_ = model; }
 void SSD1306::set_reset_pin(const GPIOOutputPin &reset_pin) { this->reset_pin_ = reset_pin.copy(); }
 void SSD1306::set_external_vcc(bool external_vcc) { this->external_vcc_ = external_vcc; }
@@ -185,13 +203,15 @@ int SSD1306::get_width_internal() {
       return 0;
   }
 }
-size_t SSD1306::get_buffer_length_() {
-  return size_t(this->get_width_internal()) * size_t(this->get_height_internal()) / 8u;
+size_t SSD1306::get_buffer_length_() { return size_t(this->get_width_internal()) * size_t(this->band_height_) / 8u; }
+uint8_t SSD1306::get_band_pages_() {
+  return std::min(int(this->band_height_), this->get_height_internal() - this->band_start_) / 8;
 }
 SSD1306::SSD1306(uint32_t update_interval) : PollingComponent(update_interval) {}
 
 void HOT SSD1306::draw_absolute_pixel_internal(int x, int y, int color) {
-  if (x >= this->get_width_internal() || x < 0 || y >= this->get_height_internal() || y < 0)
+  y -= this->band_start_;
+  if (x >= this->get_width_internal() || x < 0 || y >= this->band_height_ || y < 0)
     return;
 
   uint16_t pos = x + (y / 8) * this->get_width_internal();
@@ -204,7 +224,11 @@ void HOT SSD1306::draw_absolute_pixel_internal(int x, int y, int color) {
 }
 float SSD1306::get_setup_priority() const { return setup_priority::POST_HARDWARE; }
 void SSD1306::fill(int color) {
-  uint8_t fill = color ? 0xFF : 0x00;
+  if (this->is_clipped_()) {
+    DisplayBuffer::fill(color);
+    return;
+  }
+  uint8_t fill = color_to_binary(color) ? 0xFF : 0x00;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
     this->buffer_[i] = fill;
 }
@@ -270,8 +294,8 @@ void SPISSD1306::command(uint8_t value) {
 }
 void HOT SPISSD1306::write_display_data() {
   if (this->is_sh1106_()) {
-    for (uint8_t y = 0; y < this->get_height_internal() / 8; y++) {
-      this->command(0xB0 + y);
+    for (uint8_t y = 0; y < this->get_band_pages_(); y++) {
+      this->command(0xB0 + this->band_start_ / 8 + y);
       this->command(0x02);
       this->command(0x10);
       this->dc_pin_->digital_write(true);
@@ -285,7 +309,7 @@ void HOT SPISSD1306::write_display_data() {
   } else {
     this->dc_pin_->digital_write(true);
     this->enable();
-    this->write_array(this->buffer_, this->get_buffer_length_());
+    this->write_array(this->buffer_, this->get_band_pages_() * this->get_width_internal());
     this->disable();
   }
 }
@@ -324,8 +348,8 @@ void I2CSSD1306::command(uint8_t value) { this->write_byte(0x00, value); }
 void HOT I2CSSD1306::write_display_data() {
   if (this->is_sh1106_()) {
     uint32_t i = 0;
-    for (uint8_t page = 0; page < this->get_height_internal() / 8; page++) {
-      this->command(0xB0 + page);  // row
+    for (uint8_t page = 0; page < this->get_band_pages_(); page++) {
+      this->command(0xB0 + this->band_start_ / 8 + page);  // row
       this->command(0x02);         // lower column
       this->command(0x10);         // higher column
 
@@ -337,7 +361,7 @@ void HOT I2CSSD1306::write_display_data() {
       }
     }
   } else {
-    for (uint32_t i = 0; i < this->get_buffer_length_();) {
+    for (uint32_t i = 0; i < uint32_t(this->get_band_pages_() * this->get_width_internal());) {
       uint8_t data[16];
       for (uint8_t &j : data)
         j = this->buffer_[i++];
@@ -33,16 +33,23 @@ class SSD1306 : public PollingComponent, public DisplayBuffer {
   void display();
 
   void update() override;
+  void loop() override;
 
   void set_model(SSD1306Model model);
   void set_reset_pin(const GPIOOutputPin &reset_pin);
   void set_external_vcc(bool external_vcc);
+  /** Render the frame in bands of this many rows (rounded down to whole pages of 8 rows), 0 buffers the whole frame.
+   *
+   * The writer then runs once per band and each band is sent to the display before the next one is rendered.
+   */
+  void set_band_height(uint8_t band_height);
 
   float get_setup_priority() const override;
   void fill(int color) override;
 
  protected:
   virtual void command(uint8_t value) = 0;
+  /// Write the pages of the band the buffer currently holds to the display.
   virtual void write_display_data() = 0;
   void init_reset_();
 
@@ -52,12 +59,16 @@ class SSD1306 : public PollingComponent, public DisplayBuffer {
 
   int get_height_internal() override;
   int get_width_internal() override;
+  /// The length of the framebuffer, which holds band_height_ rows.
   size_t get_buffer_length_();
+  /// The number of pages of the band the buffer currently holds.
+  uint8_t get_band_pages_();
   const char *model_str_();
 
   SSD1306Model model_{SSD1306_MODEL_128_64};
   GPIOPin *reset_pin_{nullptr};
   bool external_vcc_{false};
+  uint8_t band_height_{0};
 };
 
 #ifdef USE_SPI
@@ -11,6 +11,12 @@ namespace display {
 
 static const char *TAG = "display.waveshare_epaper";
 
+/// How long a frame may wait for the BUSY pin before it's dropped.
+static const uint32_t WAVESHARE_EPAPER_BUSY_TIMEOUT = 5000;
+/// The 7.5in framebuffer is expanded to 4bpp while it's sent, split that into this many display steps
+/// (or one step per band).
+static const uint8_t WAVESHARE_EPAPER_7_5_IN_CHUNKS = 8;
+
 static const uint8_t WAVESHARE_EPAPER_COMMAND_DRIVER_OUTPUT_CONTROL = 0x01;
 static const uint8_t WAVESHARE_EPAPER_COMMAND_BOOSTER_SOFT_START_CONTROL = 0x0C;
 // static const uint8_t WAVESHARE_EPAPER_COMMAND_GATE_SCAN_START_POSITION = 0x0F;
@@ -43,6 +49,12 @@ static const uint8_t PARTIAL_UPDATE_LUT[30] = {0x10, 0x18, 0x18, 0x08, 0x18, 0x1
                                                0x13, 0x14, 0x44, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
 void WaveshareEPaper::setup_pins_() {
+  if (this->band_height_ == 0 || this->band_height_ > this->get_height_internal())
+    this->band_height_ = this->get_height_internal();
+  // keeps the number of display steps per frame small
+  this->band_height_ = std::max(this->band_height_, uint16_t(8));
+  // the first band, until a frame is rendered
+  this->band_end_ = this->band_height_;
   this->init_internal_(this->get_buffer_length_());
   this->dc_pin_->setup();  // OUTPUT
   this->dc_pin_->digital_write(false);
@@ -92,18 +104,112 @@ bool WaveshareEPaper::wait_until_idle_() {
 }
 void WaveshareEPaper::set_reset_pin(const GPIOOutputPin &reset) { this->reset_pin_ = reset.copy(); }
 void WaveshareEPaper::set_busy_pin(const GPIOInputPin &busy) { this->busy_pin_ = busy.copy(); }
+void WaveshareEPaper::display() {
+  for (uint8_t step = 0;; step++) {
+    if (!this->wait_until_idle_()) {
+      this->status_set_warning();
+      return;
+    }
+    if (!this->display_step_(step))
+      break;
+  }
+  this->status_clear_warning();
+}
 void WaveshareEPaper::update() {
-  this->do_update_();
-  this->display();
+  if (this->step_ != WAVESHARE_EPAPER_STEP_IDLE) {
+    // the previous frame is still being sent from the framebuffer, draw once that's done.
+    this->update_pending_ = true;
+    return;
+  }
+
+  // banded frames are rendered while they're sent
+  if (!this->is_banded_())
+    this->do_update_();
+  this->start_frame_();
+}
+void WaveshareEPaper::loop() {
+  if (this->step_ == WAVESHARE_EPAPER_STEP_IDLE && !this->frame_pending_)
+    return;
+
+  if (this->is_busy_()) {
+    if (millis() - this->wait_start_ > WAVESHARE_EPAPER_BUSY_TIMEOUT) {
+      ESP_LOGE(TAG, "Timeout while displaying image!");
+      this->status_set_warning();
+      this->finish_frame_();
+    }
+    return;
+  }
+
+  if (this->step_ == WAVESHARE_EPAPER_STEP_IDLE) {
+    this->frame_pending_ = false;
+    this->step_ = 0;
+  }
+
+  if (this->display_step_(this->step_)) {
+    this->step_++;
+    this->wait_start_ = millis();
+    return;
+  }
+
+  // The panel now refreshes on its own, the next frame waits for BUSY before it's sent.
+  this->status_clear_warning();
+  this->finish_frame_();
+}
+void WaveshareEPaper::start_frame_() {
+  this->frame_pending_ = true;
+  this->wait_start_ = millis();
+}
+void WaveshareEPaper::finish_frame_() {
+  this->step_ = WAVESHARE_EPAPER_STEP_IDLE;
+  this->frame_pending_ = false;
+  if (this->update_pending_) {
+    this->update_pending_ = false;
+    if (!this->is_banded_())
+      this->do_update_();
+    this->start_frame_();
+  }
+}
+bool WaveshareEPaper::is_banded_() { return this->band_height_ < this->get_height_internal(); }
+void WaveshareEPaper::write_frame_() {
+  if (!this->is_banded_()) {
+    this->start_data_();
+    this->write_array(this->buffer_, this->get_buffer_length_());
+    this->end_data_();
+    return;
+  }
+
+  const int height = this->get_height_internal();
+  for (int y = 0; y < height; y += this->band_height_) {
+    const int end = std::min(y + int(this->band_height_), height);
+    this->do_update_band_(y, end);
+    this->start_data_();
+    this->write_array(this->buffer_, uint32_t(end - y) * this->get_width_internal() / 8u);
+    this->end_data_();
+  }
 }
+void WaveshareEPaper::write_blank_frame_() {
+  // 0xFF is white, see fill()
+  const uint32_t length = this->get_width_internal() * this->get_height_internal() / 8u;
+  this->start_data_();
+  for (uint32_t i = 0; i < length; i++)
+    this->write_byte(0xFF);
+  this->end_data_();
+}
+void WaveshareEPaper::set_band_height(uint16_t band_height) { this->band_height_ = band_height; }
+bool WaveshareEPaper::is_busy_() { return this->busy_pin_ != nullptr && this->busy_pin_->digital_read(); }
 void WaveshareEPaper::fill(int color) {
+  if (this->is_clipped_()) {
+    DisplayBuffer::fill(color);
+    return;
+  }
   // flip logic
-  const uint8_t fill = color ? 0x00 : 0xFF;
+  const uint8_t fill = color_to_binary(color) ? 0x00 : 0xFF;
   for (uint32_t i = 0; i < this->get_buffer_length_(); i++)
     this->buffer_[i] = fill;
 }
 void HOT WaveshareEPaper::draw_absolute_pixel_internal(int x, int y, int color) {
-  if (x >= this->get_width_internal() || y >= this->get_height_internal() || x < 0 || y < 0)
+  y -= this->band_start_;
+  if (x >= this->get_width_internal() || y >= this->band_height_ || x < 0 || y < 0)
     return;
 
   const uint32_t pos = (x + y * this->get_width_internal()) / 8u;
@@ -114,7 +220,7 @@ void HOT WaveshareEPaper::draw_absolute_pixel_internal(int x, int y, int color)
   else
     this->buffer_[pos] &= ~(0x80 >> subpos);
 }
-uint32_t WaveshareEPaper::get_buffer_length_() { return this->get_width_internal() * this->get_height_internal() / 8u; }
+uint32_t WaveshareEPaper::get_buffer_length_() { return this->get_width_internal() * this->band_height_ / 8u; }
 WaveshareEPaper::WaveshareEPaper(SPIComponent *parent, GPIOPin *cs, GPIOPin *dc_pin, uint32_t update_interval)
     : PollingComponent(update_interval), SPIDevice(parent, cs), dc_pin_(dc_pin) {}
 bool WaveshareEPaper::is_device_high_speed() { return true; }
@@ -177,10 +283,16 @@ void WaveshareEPaperTypeA::dump_config() {
   LOG_PIN("  Busy Pin: ", this->busy_pin_);
   LOG_UPDATE_INTERVAL(this);
 }
-void HOT WaveshareEPaperTypeA::display() {
-  if (!this->wait_until_idle_()) {
-    this->status_set_warning();
-    return;
+bool HOT WaveshareEPaperTypeA::display_step_(uint8_t step) {
+  if (step == 1) {
+    this->command(WAVESHARE_EPAPER_COMMAND_WRITE_RAM);
+    this->write_frame_();
+
+    this->command(WAVESHARE_EPAPER_COMMAND_DISPLAY_UPDATE_CONTROL_2);
+    this->data(0xC4);
+    this->command(WAVESHARE_EPAPER_COMMAND_MASTER_ACTIVATION);
+    this->command(WAVESHARE_EPAPER_COMMAND_TERMINATE_FRAME_READ_WRITE);
+    return false;
   }
 
   if (this->full_update_every_ >= 2) {
@@ -207,23 +319,7 @@ void HOT WaveshareEPaperTypeA::display() {
   this->command(WAVESHARE_EPAPER_COMMAND_SET_RAM_Y_ADDRESS_COUNTER);
   this->data(0x00);
   this->data(0x00);
-
-  if (!this->wait_until_idle_()) {
-    this->status_set_warning();
-    return;
-  }
-
-  this->command(WAVESHARE_EPAPER_COMMAND_WRITE_RAM);
-  this->start_data_();
-  this->write_array(this->buffer_, this->get_buffer_length_());
-  this->end_data_();
-
-  this->command(WAVESHARE_EPAPER_COMMAND_DISPLAY_UPDATE_CONTROL_2);
-  this->data(0xC4);
-  this->command(WAVESHARE_EPAPER_COMMAND_MASTER_ACTIVATION);
-  this->command(WAVESHARE_EPAPER_COMMAND_TERMINATE_FRAME_READ_WRITE);
-
-  this->status_clear_warning();
+  return true;
 }
 int WaveshareEPaperTypeA::get_width_internal() {
   switch (this->model_) {
@@ -404,20 +500,25 @@ void WaveshareEPaper2P7In::setup() {
   for (uint8_t i : LUT_BLACK_TO_BLACK_2_7)
     this->data(i);
 }
-void HOT WaveshareEPaper2P7In::display() {
+bool HOT WaveshareEPaper2P7In::display_step_(uint8_t step) {
   // TODO check active frame buffer to only transmit once / use partial transmits
-  this->command(WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_1);
-  delay(2);
-  this->start_data_();
-  this->write_array(this->buffer_, this->get_buffer_length_());
-  this->end_data_();
-  delay(2);
-  this->command(WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_2);
-  delay(2);
-  this->start_data_();
-  this->write_array(this->buffer_, this->get_buffer_length_());
-  this->end_data_();
-  this->command(WAVESHARE_EPAPER_B_COMMAND_DISPLAY_REFRESH);
+  // Commands and data are sent in separate steps, that replaces the delays the panel needs in between.
+  switch (step) {
+    case 0:
+      this->command(WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_1);
+      return true;
+    case 1:
+      // the old frame, the panel doesn't need it for a full refresh
+      this->write_blank_frame_();
+      return true;
+    case 2:
+      this->command(WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_2);
+      return true;
+    default:
+      this->write_frame_();
+      this->command(WAVESHARE_EPAPER_B_COMMAND_DISPLAY_REFRESH);
+      return false;
+  }
 }
 int WaveshareEPaper2P7In::get_width_internal() { return 176; }
 int WaveshareEPaper2P7In::get_height_internal() { return 264; }
@@ -501,32 +602,36 @@ void WaveshareEPaper4P2In::setup() {
   for (uint8_t i : LUT_BLACK_TO_BLACK_4_2)
     this->data(i);
 }
-void HOT WaveshareEPaper4P2In::display() {
-  this->command(WAVESHARE_EPAPER_B_COMMAND_RESOLUTION_SETTING);
-  this->data(0x01);
-  this->data(0x90);
-  this->data(0x01);
-  this->data(0x2C);
-
-  this->command(WAVESHARE_EPAPER_B_COMMAND_VCM_DC_SETTING_REGISTER);
-  this->data(0x12);
-
-  this->command(WAVESHARE_EPAPER_B_COMMAND_VCOM_AND_DATA_INTERVAL_SETTING);
-  this->data(0x97);
-
+bool HOT WaveshareEPaper4P2In::display_step_(uint8_t step) {
   // TODO check active frame buffer to only transmit once / use partial transmits
-  this->command(WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_1);
-  delay(2);
-  this->start_data_();
-  this->write_array(this->buffer_, this->get_buffer_length_());
-  this->end_data_();
-  delay(2);
-  this->command(WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_2);
-  delay(2);
-  this->start_data_();
-  this->write_array(this->buffer_, this->get_buffer_length_());
-  this->end_data_();
-  this->command(WAVESHARE_EPAPER_B_COMMAND_DISPLAY_REFRESH);
+  switch (step) {
+    case 0:
+      this->command(WAVESHARE_EPAPER_B_COMMAND_RESOLUTION_SETTING);
+      this->data(0x01);
+      this->data(0x90);
+      this->data(0x01);
+      this->data(0x2C);
+
+      this->command(WAVESHARE_EPAPER_B_COMMAND_VCM_DC_SETTING_REGISTER);
+      this->data(0x12);
+
+      this->command(WAVESHARE_EPAPER_B_COMMAND_VCOM_AND_DATA_INTERVAL_SETTING);
+      this->data(0x97);
+
+      this->command(WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_1);
+      return true;
+    case 1:
+      // the old frame, the panel doesn't need it for a full refresh
+      this->write_blank_frame_();
+      return true;
+    case 2:
+      this->command(WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_2);
+      return true;
+    default:
+      this->write_frame_();
+      this->command(WAVESHARE_EPAPER_B_COMMAND_DISPLAY_REFRESH);
+      return false;
+  }
 }
 int WaveshareEPaper4P2In::get_width_internal() { return 400; }
 int WaveshareEPaper4P2In::get_height_internal() { return 300; }
@@ -586,11 +691,26 @@ void WaveshareEPaper7P5In::setup() {
   this->command(0xE5);
   this->data(0x03);
 }
-void HOT WaveshareEPaper7P5In::display() {
-  this->command(WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_1);
+bool HOT WaveshareEPaper7P5In::display_step_(uint8_t step) {
+  if (step == 0)
+    this->command(WAVESHARE_EPAPER_B_COMMAND_DATA_START_TRANSMISSION_1);
+
+  // Send a few rows of the framebuffer per step, the panel keeps its RAM address between the data transfers.
+  const int height = this->get_height_internal();
+  const int rows = this->is_banded_() ? this->band_height_ : height / WAVESHARE_EPAPER_7_5_IN_CHUNKS;
+  const int row_start = step * rows;
+  const int row_end = std::min(row_start + rows, height);
+  const bool last = row_end >= height;
+
+  size_t start = row_start * this->get_width_internal() / 8u;
+  if (this->is_banded_()) {
+    this->do_update_band_(row_start, row_end);
+    start = 0;
+  }
+  const size_t end = start + (row_end - row_start) * this->get_width_internal() / 8u;
 
   this->start_data_();
-  for (size_t i = 0; i < this->get_buffer_length_(); i++) {
+  for (size_t i = start; i < end; i++) {
     uint8_t temp1 = this->buffer_[i];
     for (uint8_t j = 0; j < 8; j++) {
       uint8_t temp2;
@@ -614,7 +734,11 @@ void HOT WaveshareEPaper7P5In::display() {
   }
   this->end_data_();
 
+  if (!last)
+    return true;
+
   this->command(WAVESHARE_EPAPER_B_COMMAND_DISPLAY_REFRESH);
+  return false;
 }
 int WaveshareEPaper7P5In::get_width_internal() { return 640; }
 int WaveshareEPaper7P5In::get_height_internal() { return 384; }
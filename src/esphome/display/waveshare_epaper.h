@@ -12,30 +12,64 @@ ESPHOME_NAMESPACE_BEGIN
 
 namespace display {
 
+static const uint8_t WAVESHARE_EPAPER_STEP_IDLE = 0xFF;
+
 class WaveshareEPaper : public PollingComponent, public SPIDevice, public DisplayBuffer {
  public:
   WaveshareEPaper(SPIComponent *parent, GPIOPin *cs, GPIOPin *dc_pin, uint32_t update_interval);
   float get_setup_priority() const override;
   void set_reset_pin(const GPIOOutputPin &reset);
   void set_busy_pin(const GPIOInputPin &busy);
+  /** Render the frame in bands of this many rows instead of buffering all of it, 0 buffers the whole frame.
+   *
+   * The writer then runs once per band while the frame is sent to the panel, so the framebuffer only needs
+   * to hold a single band.
+   */
+  void set_band_height(uint16_t band_height);
 
   bool is_device_msb_first() override;
   void command(uint8_t value);
   void data(uint8_t value);
 
-  virtual void display() = 0;
+  /// Send the current framebuffer to the panel, blocking until it's done. update() uses the non-blocking pipeline.
+  void display();
 
+  /** Draw a new frame and queue it for display.
+   *
+   * The refresh itself is driven by loop(): every display step only runs once the BUSY pin reports the panel
+   * as idle, so the node keeps running while the panel refreshes. The framebuffer can be drawn to as soon as
+   * it has been transferred, while the panel is still refreshing.
+   */
   void update() override;
+  void loop() override;
 
   void fill(int color) override;
 
  protected:
   void draw_absolute_pixel_internal(int x, int y, int color) override;
 
+  /** Run the given step of a display refresh.
+   *
+   * Each step is only started once the panel isn't busy anymore and must not block.
+   *
+   * @param step The step index, starting at 0.
+   * @return Whether there is another step after this one.
+   */
+  virtual bool display_step_(uint8_t step) = 0;
+  void start_frame_();
+  void finish_frame_();
+  bool is_busy_();
+  bool is_banded_();
+  /// Send the whole frame as data to the panel, rendering it band by band if necessary.
+  void write_frame_();
+  /// Send a white frame as data to the panel, without rendering anything.
+  void write_blank_frame_();
+
   bool wait_until_idle_();
 
   void setup_pins_();
 
+  /// The length of the framebuffer, which holds band_height_ rows.
   uint32_t get_buffer_length_();
 
   bool is_device_high_speed() override;
@@ -48,6 +82,14 @@ class WaveshareEPaper : public PollingComponent, public SPIDevice, public Displa
   GPIOPin *reset_pin_{nullptr};
   GPIOPin *dc_pin_;
   GPIOPin *busy_pin_{nullptr};
+  uint16_t band_height_{0};
+  /// The display step that runs next, or WAVESHARE_EPAPER_STEP_IDLE if no frame is being transferred.
+  uint8_t step_{WAVESHARE_EPAPER_STEP_IDLE};
+  /// Whether the framebuffer holds a frame that still has to be sent to the panel.
+  bool frame_pending_{false};
+  /// Whether update() was called while a frame was being transferred.
+  bool update_pending_{false};
+  uint32_t wait_start_{0};
 };
 
 enum WaveshareEPaperTypeAModel {
@@ -65,11 +107,11 @@ class WaveshareEPaperTypeA : public WaveshareEPaper {
 
   void dump_config() override;
 
-  void display() override;
-
   void set_full_update_every(uint32_t full_update_every);
 
  protected:
+  bool display_step_(uint8_t step) override;
+
   void write_lut_(const uint8_t *lut);
 
   int get_width_internal() override;
@@ -92,11 +134,11 @@ class WaveshareEPaper2P7In : public WaveshareEPaper {
   WaveshareEPaper2P7In(SPIComponent *parent, GPIOPin *cs, GPIOPin *dc_pin, uint32_t update_interval);
   void setup() override;
 
-  void display() override;
-
   void dump_config() override;
 
  protected:
+  bool display_step_(uint8_t step) override;
+
   int get_width_internal() override;
 
   int get_height_internal() override;
@@ -107,11 +149,11 @@ class WaveshareEPaper4P2In : public WaveshareEPaper {
   WaveshareEPaper4P2In(SPIComponent *parent, GPIOPin *cs, GPIOPin *dc_pin, uint32_t update_interval);
   void setup() override;
 
-  void display() override;
-
   void dump_config() override;
 
  protected:
+  bool display_step_(uint8_t step) override;
+
   int get_width_internal() override;
 
   int get_height_internal() override;
@@ -124,11 +166,11 @@ class WaveshareEPaper7P5In : public WaveshareEPaper {
   WaveshareEPaper7P5In(SPIComponent *parent, GPIOPin *cs, GPIOPin *dc_pin, uint32_t update_interval);
   void setup() override;
 
-  void display() override;
-
   void dump_config() override;
 
  protected:
+  bool display_step_(uint8_t step) override;
+
   int get_width_internal() override;
 
   int get_height_internal() override;
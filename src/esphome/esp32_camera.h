@@ -74,7 +74,7 @@ class ESP32Camera : public Component, public Nameable {
   void setup() override;
   void loop() override;
   void dump_config() override;
-  void add_image_callback(std::function<void(std::shared_ptr<CameraImage>)> &&f);
+  template<typename F> void add_image_callback(F &&f) { this->new_image_callback_.add(std::forward<F>(f)); }
   float get_setup_priority() const override;
   void request_stream();
   void request_image();
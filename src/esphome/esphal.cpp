@@ -116,6 +116,58 @@ unsigned char GPIOPin::get_pin() const { return this->pin_; }
 unsigned char GPIOPin::get_mode() const { return this->mode_; }
 
 bool GPIOPin::is_inverted() const { return this->inverted_; }
+bool GPIOPin::is_port_writable() const {
+#ifdef ARDUINO_ARCH_ESP8266
+  // GPIO16 is in the RTC block, not in the GPIO port
+  return this->pin_ < 16;
+#endif
+#ifdef ARDUINO_ARCH_ESP32
+  return true;
+#endif
+}
+
+void GPIOBatchWrite::add(GPIOPin *pin, bool value) {
+  if (!pin->is_port_writable()) {
+    pin->digital_write(value);
+    return;
+  }
+
+#ifdef ARDUINO_ARCH_ESP8266
+  volatile uint32_t *set = &GPOS;
+  volatile uint32_t *clear = &GPOC;
+#endif
+#ifdef ARDUINO_ARCH_ESP32
+  volatile uint32_t *set = pin->gpio_set_;
+  volatile uint32_t *clear = pin->gpio_clear_;
+#endif
+  Port *port = nullptr;
+  for (uint8_t i = 0; i < this->port_count_; i++) {
+    if (this->ports_[i].set == set)
+      port = &this->ports_[i];
+  }
+  if (port == nullptr) {
+    port = &this->ports_[this->port_count_++];
+    *port = Port{set, clear, 0, 0};
+  }
+
+  if (value != pin->inverted_) {
+    port->set_mask |= pin->gpio_mask_;
+    port->clear_mask &= ~pin->gpio_mask_;
+  } else {
+    port->clear_mask |= pin->gpio_mask_;
+    port->set_mask &= ~pin->gpio_mask_;
+  }
+}
+void ICACHE_RAM_ATTR HOT GPIOBatchWrite::apply() {
+  for (uint8_t i = 0; i < this->port_count_; i++) {
+    Port &port = this->ports_[i];
+    if (port.clear_mask != 0)
+      *port.clear = port.clear_mask;
+    if (port.set_mask != 0)
+      *port.set = port.set_mask;
+  }
+  this->port_count_ = 0;
+}
 void GPIOPin::setup() { this->pin_mode(this->mode_); }
 bool ICACHE_RAM_ATTR HOT GPIOPin::digital_read() {
   return bool((*this->gpio_read_) & this->gpio_mask_) != this->inverted_;
@@ -87,12 +87,16 @@ class GPIOPin {
   uint8_t get_mode() const;
   /// Return whether this pin shall be treated as inverted. (for example active-low)
   bool is_inverted() const;
+  /// Return whether this pin can be written through the GPIO port registers, see GPIOBatchWrite.
+  virtual bool is_port_writable() const;
 
   template<typename T> void attach_interrupt(void (*func)(T *), T *arg, int mode) const;
 
   ISRInternalGPIOPin *to_isr() const;
 
  protected:
+  friend class GPIOBatchWrite;
+
   void attach_interrupt_(void (*func)(void *), void *arg, int mode) const;
 
   const uint8_t pin_;
@@ -128,6 +132,32 @@ class GPIOInputPin : public GPIOPin {
   GPIOInputPin(uint8_t pin, uint8_t mode = INPUT, bool inverted = false);  // NOLINT
 };
 
+/** Collect writes to several GPIO pins and apply them with a single register write per GPIO port.
+ *
+ * This makes the pins of a port change at the same time instead of one after the other. There's no order between
+ * the pins of a batch: the clear register is written before the set register, ports are written one after the
+ * other, and pins that can't be written through a port register (GPIO16 on the ESP8266, pins of I/O expanders)
+ * are written directly when they're added. Use separate batches if some writes must happen before others.
+ */
+class GPIOBatchWrite {
+ public:
+  /// Queue writing value to pin, inversion is applied like in GPIOPin::digital_write.
+  void add(GPIOPin *pin, bool value);
+  /// Write all queued values.
+  void apply();
+
+ protected:
+  struct Port {
+    volatile uint32_t *set;
+    volatile uint32_t *clear;
+    uint32_t set_mask;
+    uint32_t clear_mask;
+  };
+
+  Port ports_[2];
+  uint8_t port_count_{0};
+};
+
 template<typename T> void GPIOPin::attach_interrupt(void (*func)(T *), T *arg, int mode) const {
   this->attach_interrupt_(reinterpret_cast<void (*)(void *)>(func), arg, mode);
 }
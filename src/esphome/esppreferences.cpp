@@ -15,11 +15,14 @@ ESPHOME_NAMESPACE_BEGIN
 
 static const char *TAG = "preferences";
 
+/// Deferred preferences are written at the latest this long after the first change, even if they keep changing.
+static const uint32_t MAX_FLUSH_DELAY = 60000;
+
 ESPPreferenceObject::ESPPreferenceObject() : rtc_offset_(0), length_words_(0), type_(0), data_(nullptr) {}
 ESPPreferenceObject::ESPPreferenceObject(size_t rtc_offset, size_t length, uint32_t type)
     : rtc_offset_(rtc_offset), length_words_(length), type_(type) {
-  this->data_ = new uint32_t[this->length_words_ + 1];
-  for (uint32_t i = 0; i < this->length_words_ + 1; i++)
+  this->data_ = new uint32_t[(this->length_words_ + 1) * 2];
+  for (uint32_t i = 0; i < (this->length_words_ + 1) * 2; i++)
     this->data_[i] = 0;
 }
 bool ESPPreferenceObject::load_() {
@@ -31,6 +34,10 @@ bool ESPPreferenceObject::load_() {
     return false;
 
   bool valid = this->data_[this->length_words_] == this->calculate_crc_();
+  if (valid) {
+    memcpy(this->data_ + this->length_words_ + 1, this->data_, (this->length_words_ + 1) * 4);
+    this->has_stored_ = true;
+  }
 
   ESP_LOGVV(TAG, "LOAD %zu: valid=%s, 0=0x%08X 1=0x%08X (Type=%u, CRC=0x%08X)", this->rtc_offset_, YESNO(valid),
             this->data_[0], this->data_[1], this->type_, this->calculate_crc_());
@@ -45,6 +52,8 @@ bool ESPPreferenceObject::save_() {
   this->data_[this->length_words_] = this->calculate_crc_();
   if (!this->save_internal_())
     return false;
+  memcpy(this->data_ + this->length_words_ + 1, this->data_, (this->length_words_ + 1) * 4);
+  this->has_stored_ = true;
   ESP_LOGVV(TAG, "SAVE %zu: 0=0x%08X 1=0x%08X (Type=%u, CRC=0x%08X)", this->rtc_offset_, this->data_[0], this->data_[1],
             this->type_, this->calculate_crc_());
   return true;
@@ -67,6 +76,8 @@ static inline bool esp_rtc_user_mem_read(uint32_t index, uint32_t *dest) {
 
 #ifdef USE_ESP8266_PREFERENCES_FLASH
 static bool esp8266_preferences_modified = false;
+/// Set while flushing deferred preferences, so that the flash sector is only written once at the end.
+static bool esp8266_flash_save_deferred = false;
 #endif
 
 static inline bool esp_rtc_user_mem_write(uint32_t index, uint32_t value) {
@@ -130,7 +141,8 @@ bool ESPPreferenceObject::save_internal_() {
   }
 
 #ifdef USE_ESP8266_PREFERENCES_FLASH
-  save_esp8266_flash();
+  if (!esp8266_flash_save_deferred)
+    save_esp8266_flash();
 #endif
   return true;
 }
@@ -230,6 +242,65 @@ uint32_t ESPPreferenceObject::calculate_crc_() const {
   return crc;
 }
 bool ESPPreferenceObject::is_initialized() const { return this->data_ != nullptr; }
+bool ESPPreferenceObject::is_stored_() const {
+  if (!this->has_stored_)
+    return false;
+  return memcmp(this->data_, this->data_ + this->length_words_ + 1, this->length_words_ * 4) == 0;
+}
+void ESPPreferenceObject::mark_dirty_() {
+  const uint32_t now = millis();
+  if (global_preferences.dirty_.empty())
+    global_preferences.first_change_ = now;
+  global_preferences.last_change_ = now;
+  if (!this->dirty_) {
+    this->dirty_ = true;
+    global_preferences.dirty_.push_back(this);
+  }
+}
+
+void ESPPreferences::set_flush_delay(uint32_t flush_delay) { this->flush_delay_ = flush_delay; }
+void ESPPreferences::loop() {
+  if (this->dirty_.empty())
+    return;
+
+  const uint32_t now = millis();
+  if (now - this->last_change_ < this->flush_delay_ && now - this->first_change_ < MAX_FLUSH_DELAY)
+    return;
+  this->flush();
+}
+bool ESPPreferences::flush() {
+  if (this->dirty_.empty())
+    return true;
+
+#ifdef USE_ESP8266_PREFERENCES_FLASH
+  esp8266_flash_save_deferred = true;
+#endif
+  std::vector<ESPPreferenceObject *> failed;
+  uint32_t written = 0;
+  for (auto *pref : this->dirty_) {
+    if (pref->is_stored_()) {
+      // changed back to the stored value
+      pref->dirty_ = false;
+      continue;
+    }
+    if (!pref->save_()) {
+      failed.push_back(pref);
+      continue;
+    }
+    pref->dirty_ = false;
+    written++;
+  }
+#ifdef USE_ESP8266_PREFERENCES_FLASH
+  esp8266_flash_save_deferred = false;
+  save_esp8266_flash();
+#endif
+
+  ESP_LOGV(TAG, "Wrote %u of %zu deferred preferences.", written, this->dirty_.size());
+  // retry the failed ones with the next flush
+  this->dirty_.swap(failed);
+  this->first_change_ = this->last_change_ = millis();
+  return this->dirty_.empty();
+}
 
 ESPPreferences global_preferences;
 
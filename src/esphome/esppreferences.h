@@ -2,6 +2,7 @@
 #define ESPHOME_ESPPREFERENCES_H
 
 #include <string>
+#include <vector>
 
 #ifdef ARDUINO_ARCH_ESP32
 #include <Preferences.h>
@@ -19,22 +20,39 @@ class ESPPreferenceObject {
 
   template<typename T> bool save(T *src);
 
+  /** Save the value later, together with the other deferred preferences.
+   *
+   * The value is written once no preference has changed for the flush delay, or before the device shuts down
+   * (see ESPPreferences::flush()). Nothing is written if the value is the same as the stored one, so this can
+   * be called on every state change. Only use this on objects that stay at the same address, like members of
+   * components.
+   */
+  template<typename T> bool save_deferred(T *src);
+
   template<typename T> bool load(T *dest);
 
   bool is_initialized() const;
 
  protected:
+  friend class ESPPreferences;
+
   bool save_();
   bool load_();
   bool save_internal_();
   bool load_internal_();
+  void mark_dirty_();
+  /// Return whether data_ is the same as the data that was last loaded or saved.
+  bool is_stored_() const;
 
   uint32_t calculate_crc_() const;
 
   size_t rtc_offset_;
   size_t length_words_;
   uint32_t type_;
+  /// The data with the CRC at the end, followed by a copy of the stored data.
   uint32_t *data_;
+  bool has_stored_{false};
+  bool dirty_{false};
 };
 
 class ESPPreferences {
@@ -44,6 +62,13 @@ class ESPPreferences {
   ESPPreferenceObject make_preference(size_t length, uint32_t type);
   template<typename T> ESPPreferenceObject make_preference(uint32_t type);
 
+  /// Set how long no deferred preference has to change before they're written, defaults to 1s.
+  void set_flush_delay(uint32_t flush_delay);
+  /// Write the deferred preferences once the flush delay has passed, called from the main loop.
+  void loop();
+  /// Write all deferred preferences now, for example before a reboot.
+  bool flush();
+
 #ifdef ARDUINO_ARCH_ESP8266
   /** On the ESP8266, we can't override the first 128 bytes during OTA uploads
    * as the eboot parameters are stored there. Writing there during an OTA upload
@@ -60,6 +85,10 @@ class ESPPreferences {
   friend ESPPreferenceObject;
 
   uint32_t current_offset_;
+  std::vector<ESPPreferenceObject *> dirty_;
+  uint32_t flush_delay_{1000};
+  uint32_t first_change_{0};
+  uint32_t last_change_{0};
 #ifdef ARDUINO_ARCH_ESP32
   Preferences preferences_;
 #endif
@@ -82,6 +111,18 @@ template<typename T> bool ESPPreferenceObject::save(T *src) {
   return this->save_();
 }
 
+template<typename T> bool ESPPreferenceObject::save_deferred(T *src) {
+  if (!this->is_initialized())
+    return false;
+  memset(this->data_, 0, this->length_words_ * 4);
+  memcpy(this->data_, src, sizeof(T));
+  // an unchanged value must not push back the flush of the other deferred preferences
+  if (!this->dirty_ && this->is_stored_())
+    return true;
+  this->mark_dirty_();
+  return true;
+}
+
 template<typename T> bool ESPPreferenceObject::load(T *dest) {
   memset(this->data_, 0, this->length_words_ * 4);
   if (!this->load_())
@@ -14,9 +14,7 @@ static const char *TAG = "fan.state";
 
 const FanTraits &FanState::get_traits() const { return this->traits_; }
 void FanState::set_traits(const FanTraits &traits) { this->traits_ = traits; }
-void FanState::add_on_state_callback(std::function<void()> &&callback) {
-  this->state_callback_.add(std::move(callback));
-}
+uint8_t FanState::get_changed_fields() const { return this->changed_fields_; }
 FanState::FanState(const std::string &name) : Nameable(name) {}
 
 FanState::StateCall FanState::turn_on() { return this->make_call().set_state(true); }
@@ -24,12 +22,6 @@ FanState::StateCall FanState::turn_off() { return this->make_call().set_state(fa
 FanState::StateCall FanState::toggle() { return this->make_call().set_state(!this->state); }
 FanState::StateCall FanState::make_call() { return FanState::StateCall(this); }
 
-struct FanStateRTCState {
-  bool state;
-  FanSpeed speed;
-  bool oscillating;
-};
-
 void FanState::setup() {
   this->rtc_ = global_preferences.make_preference<FanStateRTCState>(this->get_object_id_hash());
   FanStateRTCState recovered;
@@ -38,12 +30,23 @@ void FanState::setup() {
 
   auto call = this->make_call();
   call.set_state(recovered.state);
-  call.set_speed(recovered.speed);
-  call.set_oscillating(recovered.oscillating);
+  if (this->traits_.supports_speed())
+    call.set_speed(recovered.speed);
+  if (this->traits_.supports_oscillation())
+    call.set_oscillating(recovered.oscillating);
   call.perform();
 }
 float FanState::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
 uint32_t FanState::hash_base() { return 418001110UL; }
+void FanState::save_state_() {
+  FanStateRTCState state{};
+  // initialize as zero so that padding doesn't make identical states compare unequal
+  memset(&state, 0, sizeof(FanStateRTCState));
+  state.state = this->state;
+  state.speed = this->speed;
+  state.oscillating = this->oscillating;
+  this->rtc_.save_deferred(&state);
+}
 #ifdef USE_MQTT_FAN
 MQTTFanComponent *FanState::get_mqtt() const { return this->mqtt_; }
 void FanState::set_mqtt(MQTTFanComponent *mqtt) { this->mqtt_ = mqtt; }
@@ -74,19 +77,32 @@ FanState::StateCall &FanState::StateCall::set_speed(optional<FanSpeed> speed) {
   this->speed_ = speed;
   return *this;
 }
+bool FanState::StateCall::validate_(bool supported, const char *field) const {
+  if (!supported)
+    ESP_LOGW(TAG, "'%s' - %s is not supported by this fan!", this->state_->get_name().c_str(), field);
+  return supported;
+}
 void FanState::StateCall::perform() const {
-  if (this->binary_state_.has_value()) {
+  const FanTraits &traits = this->state_->get_traits();
+  uint8_t changed = 0;
+  if (this->binary_state_.has_value() && this->state_->state != *this->binary_state_) {
     this->state_->state = *this->binary_state_;
+    changed |= FAN_FIELD_STATE;
   }
-  if (this->oscillating_.has_value()) {
+  if (this->oscillating_.has_value() && this->validate_(traits.supports_oscillation(), "Oscillation") &&
+      this->state_->oscillating != *this->oscillating_) {
     this->state_->oscillating = *this->oscillating_;
+    changed |= FAN_FIELD_OSCILLATING;
   }
-  if (this->speed_.has_value()) {
+  if (this->speed_.has_value() && this->validate_(traits.supports_speed(), "Speed")) {
     switch (*this->speed_) {
       case FAN_SPEED_LOW:
       case FAN_SPEED_MEDIUM:
       case FAN_SPEED_HIGH:
-        this->state_->speed = *this->speed_;
+        if (this->state_->speed != *this->speed_) {
+          this->state_->speed = *this->speed_;
+          changed |= FAN_FIELD_SPEED;
+        }
         break;
       default:
         // protect from invalid input
@@ -94,13 +110,12 @@ void FanState::StateCall::perform() const {
     }
   }
 
-  FanStateRTCState saved;
-  saved.state = this->state_->state;
-  saved.speed = this->state_->speed;
-  saved.oscillating = this->state_->oscillating;
-  this->state_->rtc_.save(&saved);
+  if (changed != 0)
+    this->state_->save_state_();
 
+  this->state_->changed_fields_ = changed;
   this->state_->state_callback_.call();
+  this->state_->changed_fields_ = 0;
 }
 FanState::StateCall &FanState::StateCall::set_speed(const char *speed) {
   if (strcasecmp(speed, "low") == 0) {
@@ -21,6 +21,21 @@ enum FanSpeed {
   FAN_SPEED_HIGH = 2     ///< The fan is running on high/full speed.
 };
 
+/// The fields of a fan state, used to tell the frontends which fields changed with a state call.
+enum FanStateField : uint8_t {
+  FAN_FIELD_STATE = 1 << 0,
+  FAN_FIELD_OSCILLATING = 1 << 1,
+  FAN_FIELD_SPEED = 1 << 2,
+  FAN_FIELD_ALL = FAN_FIELD_STATE | FAN_FIELD_OSCILLATING | FAN_FIELD_SPEED,
+};
+
+/// Struct used to save the state of the fan in restore memory.
+struct FanStateRTCState {
+  bool state;
+  FanSpeed speed;
+  bool oscillating;
+};
+
 template<typename... Ts> class TurnOnAction;
 template<typename... Ts> class TurnOffAction;
 template<typename... Ts> class ToggleAction;
@@ -42,13 +57,21 @@ class FanState : public Nameable, public Component {
   explicit FanState(const std::string &name);
 
   /// Register a callback that will be called each time the state changes.
-  void add_on_state_callback(std::function<void()> &&callback);
+  template<typename F> void add_on_state_callback(F &&callback) {
+    this->state_callback_.add(std::forward<F>(callback));
+  }
 
   /// Get the traits of this fan (i.e. what features it supports).
   const FanTraits &get_traits() const;
   /// Set the traits of this fan (i.e. what features it supports).
   void set_traits(const FanTraits &traits);
 
+  /** The FanStateFields that changed with the last state call.
+   *
+   * Only valid while the state callbacks run, frontends use this to only send what changed.
+   */
+  uint8_t get_changed_fields() const;
+
   template<typename... Ts> TurnOnAction<Ts...> *make_turn_on_action();
   template<typename... Ts> TurnOffAction<Ts...> *make_turn_off_action();
   template<typename... Ts> ToggleAction<Ts...> *make_toggle_action();
@@ -75,6 +98,9 @@ class FanState : public Nameable, public Component {
     void perform() const;
 
    protected:
+    /// Check a requested field against the traits of the fan, unsupported fields are ignored.
+    bool validate_(bool supported, const char *field) const;
+
     FanState *const state_;
     optional<bool> binary_state_;
     optional<bool> oscillating_{};
@@ -96,9 +122,16 @@ class FanState : public Nameable, public Component {
 
  protected:
   uint32_t hash_base() override;
+  /** Save the state to restore memory.
+   *
+   * The state is saved deferred: it's written once the preferences stopped changing for the flush delay or on
+   * shutdown, and only if it differs from the stored one.
+   */
+  void save_state_();
 
   FanTraits traits_{};
   CallbackManager<void()> state_callback_{};
+  uint8_t changed_fields_{0};
   ESPPreferenceObject rtc_;
 #ifdef USE_MQTT_FAN
   MQTTFanComponent *mqtt_{nullptr};
@@ -69,8 +69,17 @@ void MQTTFanComponent::setup() {
     });
   }
 
-  auto f = std::bind(&MQTTFanComponent::publish_state, this);
-  this->state_->add_on_state_callback([this, f]() { this->defer("send", f); });
+  this->state_->add_on_state_callback([this]() {
+    uint8_t changed = this->state_->get_changed_fields();
+    if (changed == 0)
+      return;
+    // the publish is deferred, so collect the changed fields until it runs
+    this->pending_fields_ |= changed;
+    this->defer("send", [this]() {
+      this->publish_state_(this->pending_fields_);
+      this->pending_fields_ = 0;
+    });
+  });
 }
 bool MQTTFanComponent::send_initial_state() { return this->publish_state(); }
 std::string MQTTFanComponent::friendly_name() const { return this->state_->get_name(); }
@@ -85,17 +94,21 @@ void MQTTFanComponent::send_discovery(JsonObject &root, mqtt::SendDiscoveryConfi
   }
 }
 bool MQTTFanComponent::is_internal() { return this->state_->is_internal(); }
-bool MQTTFanComponent::publish_state() {
-  const char *state_s = this->state_->state ? "ON" : "OFF";
-  ESP_LOGD(TAG, "'%s' Sending state %s.", this->state_->get_name().c_str(), state_s);
-  this->publish(this->get_state_topic_(), state_s);
+bool MQTTFanComponent::publish_state() { return this->publish_state_(FAN_FIELD_ALL); }
+bool MQTTFanComponent::publish_state_(uint8_t fields) {
   bool failed = false;
-  if (this->state_->get_traits().supports_oscillation()) {
+  if (fields & FAN_FIELD_STATE) {
+    const char *state_s = this->state_->state ? "ON" : "OFF";
+    ESP_LOGD(TAG, "'%s' Sending state %s.", this->state_->get_name().c_str(), state_s);
+    bool success = this->publish(this->get_state_topic_(), state_s);
+    failed = failed || !success;
+  }
+  if ((fields & FAN_FIELD_OSCILLATING) && this->state_->get_traits().supports_oscillation()) {
     bool success = this->publish(this->get_oscillation_state_topic(),
                                  this->state_->oscillating ? "oscillate_on" : "oscillate_off");
     failed = failed || !success;
   }
-  if (this->state_->get_traits().supports_speed()) {
+  if ((fields & FAN_FIELD_SPEED) && this->state_->get_traits().supports_speed()) {
     const char *payload;
     switch (this->state_->speed) {
       case FAN_SPEED_LOW: {
@@ -29,6 +29,7 @@ class MQTTFanComponent : public mqtt::MQTTComponent {
   void setup() override;
   /// Send the full current state to MQTT.
   bool send_initial_state() override;
+  /// Send the full current state to MQTT.
   bool publish_state();
   /// 'fan' component type for discovery.
   std::string component_type() const override;
@@ -39,8 +40,11 @@ class MQTTFanComponent : public mqtt::MQTTComponent {
 
  protected:
   std::string friendly_name() const override;
+  /// Send the FanStateFields in fields to MQTT.
+  bool publish_state_(uint8_t fields);
 
   FanState *state_;
+  uint8_t pending_fields_{0};
 };
 
 }  // namespace fan
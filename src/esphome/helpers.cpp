@@ -423,11 +423,12 @@ optional<float> parse_float(const std::string &str) {
     return {};
   return value;
 }
-uint32_t fnv1_hash(const std::string &str) {
+uint32_t fnv1_hash(const std::string &str) { return fnv1_hash(str.data(), str.size()); }
+uint32_t fnv1_hash(const char *data, size_t len) {
   uint32_t hash = 2166136261UL;
-  for (char c : str) {
+  for (size_t i = 0; i < len; i++) {
     hash *= 16777619UL;
-    hash ^= c;
+    hash ^= data[i];
   }
   return hash;
 }
@@ -248,22 +248,106 @@ template<int...> struct seq {};                                       // NOLINT
 template<int N, int... S> struct gens : gens<N - 1, N - 1, S...> {};  // NOLINT
 template<int... S> struct gens<0, S...> { using type = seq<S...>; };  // NOLINT
 
+template<bool B, class T = void> using enable_if_t = typename std::enable_if<B, T>::type;
+
+/// Functors up to this size are stored inside a Delegate, enough for a std::function on the ESPs.
+static const size_t DELEGATE_INLINE_SIZE = 4 * sizeof(void *);
+
+template<typename... X> class Delegate;
+
+/** A move-only callable wrapper like std::function that stores small functors without allocating.
+ *
+ * Lambdas that capture a few pointers (or a std::function on 32-bit targets) are kept in an inline buffer,
+ * larger ones are moved to the heap. Calling it is a single indirect call.
+ *
+ * @tparam Ts The arguments of the callable, wrapped in void().
+ */
+template<typename... Ts> class Delegate<void(Ts...)> {
+ public:
+  Delegate() = default;
+  template<typename F, enable_if_t<!std::is_same<typename std::decay<F>::type, Delegate>::value, int> = 0>
+  Delegate(F &&f) {  // NOLINT
+    using Functor = typename std::decay<F>::type;
+    this->init_<Functor>(std::forward<F>(f), std::integral_constant < bool,
+                         sizeof(Functor) <= DELEGATE_INLINE_SIZE && alignof(Functor) <= alignof(void *) > ());
+  }
+  Delegate(Delegate &&other) noexcept : invoke_(other.invoke_), manage_(other.manage_) {
+    if (this->manage_ != nullptr)
+      this->manage_(&this->storage_, &other.storage_);
+    other.invoke_ = nullptr;
+    other.manage_ = nullptr;
+  }
+  Delegate &operator=(Delegate &&other) noexcept {
+    if (this != &other) {
+      this->~Delegate();
+      new (this) Delegate(std::move(other));
+    }
+    return *this;
+  }
+  Delegate(const Delegate &) = delete;
+  Delegate &operator=(const Delegate &) = delete;
+  ~Delegate() {
+    if (this->manage_ != nullptr)
+      this->manage_(nullptr, &this->storage_);
+  }
+
+  explicit operator bool() const { return this->invoke_ != nullptr; }
+  void operator()(Ts... args) { this->invoke_(&this->storage_, args...); }
+
+ protected:
+  using Storage = typename std::aligned_storage<DELEGATE_INLINE_SIZE, alignof(void *)>::type;
+
+  template<typename Functor, typename F> void init_(F &&f, std::true_type /*inline*/) {
+    new (&this->storage_) Functor(std::forward<F>(f));
+    this->invoke_ = [](Storage *storage, Ts... args) { (*reinterpret_cast<Functor *>(storage))(args...); };
+    this->manage_ = [](Storage *dst, Storage *src) {
+      auto *functor = reinterpret_cast<Functor *>(src);
+      if (dst != nullptr)
+        new (dst) Functor(std::move(*functor));
+      functor->~Functor();
+    };
+  }
+  template<typename Functor, typename F> void init_(F &&f, std::false_type /*inline*/) {
+    *reinterpret_cast<Functor **>(&this->storage_) = new Functor(std::forward<F>(f));
+    this->invoke_ = [](Storage *storage, Ts... args) { (**reinterpret_cast<Functor **>(storage))(args...); };
+    this->manage_ = [](Storage *dst, Storage *src) {
+      auto **functor = reinterpret_cast<Functor **>(src);
+      if (dst != nullptr) {
+        *reinterpret_cast<Functor **>(dst) = *functor;
+      } else {
+        delete *functor;
+      }
+    };
+  }
+
+  Storage storage_;
+  void (*invoke_)(Storage *storage, Ts... args){nullptr};
+  /// Move the functor from src to dst, or destroy src if dst is null.
+  void (*manage_)(Storage *dst, Storage *src){nullptr};
+};
+
+static_assert(sizeof(Delegate<void()>) == DELEGATE_INLINE_SIZE + 2 * sizeof(void *),
+              "Delegate should only hold the inline buffer and two function pointers");
+
 template<typename... X> class CallbackManager;
 
 /** Simple helper class to allow having multiple subscribers to a signal.
+ *
+ * Callbacks are stored as Delegates, so small lambdas live inside the vector and are called without going
+ * through a std::function.
  *
  * @tparam Ts The arguments for the callback, wrapped in void().
  */
 template<typename... Ts> class CallbackManager<void(Ts...)> {
  public:
   /// Add a callback to the internal callback list.
-  void add(std::function<void(Ts...)> &&callback);
+  template<typename F> void add(F &&callback) { this->callbacks_.emplace_back(std::forward<F>(callback)); }
 
   /// Call all callbacks in this manager.
   void call(Ts... args);
 
  protected:
-  std::vector<std::function<void(Ts...)>> callbacks_;
+  std::vector<Delegate<void(Ts...)>> callbacks_;
 };
 
 // https://stackoverflow.com/a/37161919/8924614
@@ -277,26 +361,91 @@ struct is_callable  // NOLINT
   static constexpr auto value = decltype(test<T>(nullptr))::value;  // NOLINT
 };
 
-template<bool B, class T = void> using enable_if_t = typename std::enable_if<B, T>::type;
+/// Whether a functor fits one pointer-sized slot and can be copied bytewise, like the [=] lambdas from codegen.
+template<typename F> struct is_small_trivial_functor {  // NOLINT
+  static constexpr bool value = sizeof(F) <= sizeof(void *) && alignof(F) <= alignof(void *) &&  // NOLINT
+                                __has_trivial_copy(F) && std::is_trivially_destructible<F>::value;
+};
 
+/** A value for an automation parameter that's either a constant or computed by a lambda.
+ *
+ * Only what's configured is stored: the constant, a function pointer (for lambdas without captures), the bytes
+ * of a small trivially copyable lambda (generated [=] lambdas usually capture nothing) or, on the slow path for
+ * larger captures, a heap allocated std::function.
+ */
 template<typename T, typename... X> class TemplatableValue {
  public:
   TemplatableValue() : type_(EMPTY) {}
 
   template<typename F, enable_if_t<!is_callable<F, X...>::value, int> = 0>
-  TemplatableValue(F value) : type_(VALUE), value_(value) {}
+  TemplatableValue(F value) : type_(VALUE) {
+    new (&this->value_) T(value);
+  }
+
+  template<typename F, enable_if_t<is_callable<F, X...>::value && std::is_convertible<F, T (*)(X...)>::value, int> = 0>
+  TemplatableValue(F f) : type_(FUNCTION) {
+    this->f_ = f;
+  }
+
+  template<typename Functor,
+           enable_if_t<is_callable<Functor, X...>::value && !std::is_convertible<Functor, T (*)(X...)>::value &&
+                           is_small_trivial_functor<Functor>::value,
+                       int> = 0>
+  TemplatableValue(Functor f) : type_(INLINE_LAMBDA) {
+    new (&this->inline_.storage) Functor(f);
+    this->inline_.invoke = [](void *storage, X... x) -> T { return (*reinterpret_cast<Functor *>(storage))(x...); };
+  }
+
+  template<typename F, enable_if_t<is_callable<F, X...>::value && !std::is_convertible<F, T (*)(X...)>::value &&
+                                       !is_small_trivial_functor<F>::value,
+                                   int> = 0>
+  TemplatableValue(F f) : type_(LAMBDA) {
+    this->lambda_ = new std::function<T(X...)>(f);
+  }
 
-  template<typename F, enable_if_t<is_callable<F, X...>::value, int> = 0>
-  TemplatableValue(F f) : type_(LAMBDA), f_(f) {}
+  TemplatableValue(const TemplatableValue &other) : type_(EMPTY) { *this = other; }
+  TemplatableValue &operator=(const TemplatableValue &other) {
+    if (this == &other)
+      return *this;
+    this->reset_();
+    switch (other.type_) {
+      case VALUE:
+        new (&this->value_) T(other.value_);
+        break;
+      case FUNCTION:
+        this->f_ = other.f_;
+        break;
+      case INLINE_LAMBDA:
+        this->inline_ = other.inline_;
+        break;
+      case LAMBDA:
+        this->lambda_ = new std::function<T(X...)>(*other.lambda_);
+        break;
+      case EMPTY:
+        break;
+    }
+    this->type_ = other.type_;
+    return *this;
+  }
+  ~TemplatableValue() { this->reset_(); }
 
   bool has_value() { return this->type_ != EMPTY; }
 
   T value(X... x) {
-    if (this->type_ == LAMBDA) {
-      return this->f_(x...);
+    switch (this->type_) {
+      case VALUE:
+        return this->value_;
+      case FUNCTION:
+        return this->f_(x...);
+      case INLINE_LAMBDA:
+        return this->inline_.invoke(&this->inline_.storage, x...);
+      case LAMBDA:
+        return (*this->lambda_)(x...);
+      case EMPTY:
+      default:
+        // return value also when empty
+        return T();
     }
-    // return value also when empty
-    return this->value_;
   }
 
   optional<T> optional_value(X... x) {
@@ -307,14 +456,32 @@ template<typename T, typename... X> class TemplatableValue {
   }
 
  protected:
-  enum {
+  void reset_() {
+    if (this->type_ == VALUE) {
+      this->value_.~T();
+    } else if (this->type_ == LAMBDA) {
+      delete this->lambda_;
+    }
+    this->type_ = EMPTY;
+  }
+
+  enum : uint8_t {
     EMPTY,
     VALUE,
+    FUNCTION,
+    INLINE_LAMBDA,
     LAMBDA,
   } type_;
 
-  T value_;
-  std::function<T(X...)> f_;
+  union {
+    T value_;
+    T (*f_)(X...);
+    struct {
+      typename std::aligned_storage<sizeof(void *), alignof(void *)>::type storage;
+      T (*invoke)(void *storage, X... x);
+    } inline_;
+    std::function<T(X...)> *lambda_;
+  };
 };
 
 extern CallbackManager<void(const char *)> shutdown_hooks;
@@ -377,6 +544,8 @@ template<typename T> class Deduplicator {
 };
 
 uint32_t fnv1_hash(const std::string &str);
+/// FNV-1 hash of a raw buffer, gives the same result as the std::string version for the same bytes.
+uint32_t fnv1_hash(const char *data, size_t len);
 
 // ================================================
 //                 Definitions
@@ -398,9 +567,6 @@ template<typename T, typename... Args> std::unique_ptr<T> make_unique(Args &&...
   return std::unique_ptr<T>(new T(std::forward<Args>(args)...));
 }
 
-template<typename... Ts> void CallbackManager<void(Ts...)>::add(std::function<void(Ts...)> &&callback) {
-  this->callbacks_.push_back(std::move(callback));
-}
 template<typename... Ts> void CallbackManager<void(Ts...)>::call(Ts... args) {
   for (auto &cb : this->callbacks_)
     cb(args...);
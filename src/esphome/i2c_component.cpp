@@ -4,6 +4,7 @@
 
 #include "esphome/i2c_component.h"
 #include "esphome/log.h"
+#include <algorithm>
 
 ESPHOME_NAMESPACE_BEGIN
 
@@ -30,12 +31,53 @@ void I2CComponent::set_frequency(uint32_t frequency) { this->frequency_ = freque
 void I2CComponent::setup() {
   this->wire_->begin(this->sda_pin_, this->scl_pin_);
   this->wire_->setClock(this->frequency_);
+
+  for (size_t i = 0; i < this->poll_groups_.size(); i++) {
+    this->set_interval(this->poll_groups_[i].update_interval, [this, i]() { this->start_poll_group_(i); });
+  }
+}
+void I2CComponent::add_polled_device_(PollingComponent *component, I2CPollingDevice *device) {
+  component->set_externally_polled(true);
+  const uint32_t update_interval = component->get_update_interval();
+  for (auto &group : this->poll_groups_) {
+    if (group.update_interval == update_interval) {
+      group.devices.push_back(PolledDevice{component, device, false});
+      return;
+    }
+  }
+  this->poll_groups_.push_back(PollGroup{update_interval, {PolledDevice{component, device, false}}});
+}
+void I2CComponent::start_poll_group_(size_t index) {
+  auto &group = this->poll_groups_[index];
+  uint32_t wait = 0;
+  for (auto &polled : group.devices) {
+    polled.started = false;
+    if (polled.component->is_failed())
+      continue;
+    uint32_t conversion_time = 0;
+    if (!polled.device->start_conversion(&conversion_time))
+      continue;
+    polled.started = true;
+    wait = std::max(wait, conversion_time);
+  }
+  ESP_LOGVV(TAG, "Started poll group %zu, reading results in %u ms", index, wait);
+  this->set_timeout(wait, [this, index]() { this->read_poll_group_(index); });
+}
+void I2CComponent::read_poll_group_(size_t index) {
+  for (auto &polled : this->poll_groups_[index].devices) {
+    if (polled.started)
+      polled.device->read_conversion();
+    polled.started = false;
+  }
 }
 void I2CComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "I2C Bus:");
   ESP_LOGCONFIG(TAG, "  SDA Pin: GPIO%u", this->sda_pin_);
   ESP_LOGCONFIG(TAG, "  SCL Pin: GPIO%u", this->scl_pin_);
   ESP_LOGCONFIG(TAG, "  Frequency: %u Hz", this->frequency_);
+  for (auto &group : this->poll_groups_) {
+    ESP_LOGCONFIG(TAG, "  Poll Group: %zu devices every %u ms", group.devices.size(), group.update_interval);
+  }
   if (this->scan_) {
     ESP_LOGI(TAG, "Scanning i2c bus for active devices...");
     uint8_t found = 0;
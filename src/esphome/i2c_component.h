@@ -12,6 +12,25 @@ ESPHOME_NAMESPACE_BEGIN
 
 #define LOG_I2C_DEVICE(this) ESP_LOGCONFIG(TAG, "  Address: 0x%02X", this->address_);
 
+/** Interface for i2c polling components whose update can be split into starting a conversion and reading its result.
+ *
+ * I2CComponent uses this to poll several devices with the same update interval together: all conversions are
+ * started back to back and all results are read once the slowest conversion has finished, so that the
+ * conversion times overlap instead of adding up (see I2CComponent::add_polled_device).
+ */
+class I2CPollingDevice {
+ public:
+  /** Start a conversion (measurement) on the device.
+   *
+   * @param conversion_time Set to the time in ms after which read_conversion() can be called.
+   * @return Whether the conversion was started successfully.
+   */
+  virtual bool start_conversion(uint32_t *conversion_time) = 0;
+
+  /// Read the result of the conversion started with start_conversion() and publish it.
+  virtual void read_conversion() = 0;
+};
+
 /** The I2CComponent is the base of ESPHome's i2c communication.
  *
  * It handles setting up the bus (with pins, clock frequency) and provides nice helper functions to
@@ -128,7 +147,31 @@ class I2CComponent : public Component {
   /// Set a very high setup priority to make sure it's loaded before all other hardware.
   float get_setup_priority() const override;
 
+  /** Let this bus trigger the updates of a polling device instead of the device's own update interval.
+   *
+   * Devices with the same update interval form a poll group: all their conversions are started together
+   * and all results are collected after the longest conversion time. Must be called before setup().
+   *
+   * @param device The device, must be both a PollingComponent and an I2CPollingDevice.
+   */
+  template<typename T> void add_polled_device(T *device) { this->add_polled_device_(device, device); }
+
  protected:
+  void add_polled_device_(PollingComponent *component, I2CPollingDevice *device);
+  void start_poll_group_(size_t index);
+  void read_poll_group_(size_t index);
+
+  struct PolledDevice {
+    PollingComponent *component;
+    I2CPollingDevice *device;
+    bool started;
+  };
+  struct PollGroup {
+    uint32_t update_interval;
+    std::vector<PolledDevice> devices;
+  };
+
+  std::vector<PollGroup> poll_groups_;
   TwoWire *wire_;
   uint8_t sda_pin_;
   uint8_t scl_pin_;
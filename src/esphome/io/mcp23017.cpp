@@ -100,6 +100,7 @@ void MCP23017::update_reg_(uint8_t pin, bool pin_value, uint8_t reg_addr) {
 MCP23017GPIOInputPin::MCP23017GPIOInputPin(MCP23017 *parent, uint8_t pin, uint8_t mode, bool inverted)
     : GPIOInputPin(pin, mode, inverted), parent_(parent) {}
 GPIOPin *MCP23017GPIOInputPin::copy() const { return new MCP23017GPIOInputPin(*this); }
+bool MCP23017GPIOInputPin::is_port_writable() const { return false; }
 void MCP23017GPIOInputPin::setup() { this->pin_mode(this->mode_); }
 void MCP23017GPIOInputPin::pin_mode(uint8_t mode) { this->parent_->pin_mode(this->pin_, mode); }
 bool MCP23017GPIOInputPin::digital_read() { return this->parent_->digital_read(this->pin_) != this->inverted_; }
@@ -109,6 +110,7 @@ void MCP23017GPIOInputPin::digital_write(bool value) {
 MCP23017GPIOOutputPin::MCP23017GPIOOutputPin(MCP23017 *parent, uint8_t pin, uint8_t mode, bool inverted)
     : GPIOOutputPin(pin, mode, inverted), parent_(parent) {}
 GPIOPin *MCP23017GPIOOutputPin::copy() const { return new MCP23017GPIOOutputPin(*this); }
+bool MCP23017GPIOOutputPin::is_port_writable() const { return false; }
 void MCP23017GPIOOutputPin::setup() { this->pin_mode(this->mode_); }
 void MCP23017GPIOOutputPin::pin_mode(uint8_t mode) { this->parent_->pin_mode(this->pin_, mode); }
 bool MCP23017GPIOOutputPin::digital_read() { return this->parent_->digital_read(this->pin_) != this->inverted_; }
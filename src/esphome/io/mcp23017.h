@@ -88,6 +88,7 @@ class MCP23017GPIOInputPin : public GPIOInputPin {
   void pin_mode(uint8_t mode) override;
   bool digital_read() override;
   void digital_write(bool value) override;
+  bool is_port_writable() const override;
 
  protected:
   MCP23017 *parent_;
@@ -103,6 +104,7 @@ class MCP23017GPIOOutputPin : public GPIOOutputPin {
   void pin_mode(uint8_t mode) override;
   bool digital_read() override;
   void digital_write(bool value) override;
+  bool is_port_writable() const override;
 
  protected:
   MCP23017 *parent_;
@@ -130,6 +130,7 @@ void PCF8574GPIOInputPin::digital_write(bool value) {
 PCF8574GPIOInputPin::PCF8574GPIOInputPin(PCF8574Component *parent, uint8_t pin, uint8_t mode, bool inverted)
     : GPIOInputPin(pin, mode, inverted), parent_(parent) {}
 GPIOPin *PCF8574GPIOInputPin::copy() const { return new PCF8574GPIOInputPin(*this); }
+bool PCF8574GPIOInputPin::is_port_writable() const { return false; }
 void PCF8574GPIOInputPin::pin_mode(uint8_t mode) { this->parent_->pin_mode(this->pin_, mode); }
 
 void PCF8574GPIOOutputPin::setup() { this->pin_mode(this->mode_); }
@@ -140,6 +141,7 @@ void PCF8574GPIOOutputPin::digital_write(bool value) {
 PCF8574GPIOOutputPin::PCF8574GPIOOutputPin(PCF8574Component *parent, uint8_t pin, uint8_t mode, bool inverted)
     : GPIOOutputPin(pin, mode, inverted), parent_(parent) {}
 GPIOPin *PCF8574GPIOOutputPin::copy() const { return new PCF8574GPIOOutputPin(*this); }
+bool PCF8574GPIOOutputPin::is_port_writable() const { return false; }
 void PCF8574GPIOOutputPin::pin_mode(uint8_t mode) { this->parent_->pin_mode(this->pin_, mode); }
 
 }  // namespace io
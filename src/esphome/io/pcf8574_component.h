@@ -89,6 +89,7 @@ class PCF8574GPIOInputPin : public GPIOInputPin {
   void pin_mode(uint8_t mode) override;
   bool digital_read() override;
   void digital_write(bool value) override;
+  bool is_port_writable() const override;
 
  protected:
   PCF8574Component *parent_;
@@ -105,6 +106,7 @@ class PCF8574GPIOOutputPin : public GPIOOutputPin {
   void pin_mode(uint8_t mode) override;
   bool digital_read() override;
   void digital_write(bool value) override;
+  bool is_port_writable() const override;
 
  protected:
   PCF8574Component *parent_;
@@ -333,6 +333,8 @@ void LightCall::perform() {
 
   if (this->save_) {
     LightStateRTCState saved;
+    // zero the padding too, otherwise an unchanged state doesn't compare equal to the stored one
+    memset(static_cast<void *>(&saved), 0, sizeof(LightStateRTCState));
     saved.state = v.is_on();
     saved.brightness = v.get_brightness();
     saved.red = v.get_red();
@@ -341,7 +343,7 @@ void LightCall::perform() {
     saved.white = v.get_white();
     saved.color_temp = v.get_color_temperature();
     saved.effect = this->parent_->active_effect_index_;
-    this->parent_->rtc_.save(&saved);
+    this->parent_->rtc_.save_deferred(&saved);
   }
 }
 
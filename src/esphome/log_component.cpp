@@ -127,9 +127,6 @@ void LogComponent::set_log_level(const std::string &tag, int log_level) {
 size_t LogComponent::get_tx_buffer_size() const { return this->tx_buffer_.capacity(); }
 void LogComponent::set_tx_buffer_size(size_t tx_buffer_size) { this->tx_buffer_.reserve(tx_buffer_size); }
 UARTSelection LogComponent::get_uart() const { return this->uart_; }
-void LogComponent::add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback) {
-  this->log_callback_.add(std::move(callback));
-}
 float LogComponent::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
 const char *LOG_LEVELS[] = {"NONE", "ERROR", "WARN", "INFO", "DEBUG", "VERBOSE", "VERY_VERBOSE"};
 #ifdef ARDUINO_ARCH_ESP32
@@ -75,7 +75,7 @@ class LogComponent : public Component {
   int level_for(const char *tag);
 
   /// Register a callback that will be called for every log message sent
-  void add_on_log_callback(std::function<void(int, const char *, const char *)> &&callback);
+  template<typename F> void add_on_log_callback(F &&callback) { this->log_callback_.add(std::forward<F>(callback)); }
 
   float get_setup_priority() const override;
 
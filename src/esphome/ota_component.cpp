@@ -184,6 +184,8 @@ void OTAComponent::handle_() {
   }
   ESP_LOGV(TAG, "OTA size is %u bytes", ota_size);
 
+  // write deferred preferences now, parts of the RTC memory can't be written during the update
+  global_preferences.flush();
 #ifdef ARDUINO_ARCH_ESP8266
   global_preferences.prevent_write(true);
 #endif
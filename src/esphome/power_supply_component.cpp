@@ -21,6 +21,7 @@ void PowerSupplyComponent::setup() {
 
   add_shutdown_hook([this](const char *cause) {
     this->active_requests_ = 0;
+    this->off_pending_ = false;
     this->pin_->digital_write(false);
   });
 }
@@ -43,16 +44,19 @@ uint32_t PowerSupplyComponent::get_keep_on_time() const { return this->keep_on_t
 void PowerSupplyComponent::set_keep_on_time(uint32_t keep_on_time) { this->keep_on_time_ = keep_on_time; }
 
 void PowerSupplyComponent::request_high_power() {
-  this->cancel_timeout("power-supply-off");
-  this->pin_->digital_write(true);
+  // a new request always cancels a pending turn off
+  if (this->off_pending_) {
+    this->cancel_timeout("power-supply-off");
+    this->off_pending_ = false;
+  }
 
-  if (this->active_requests_ == 0) {
+  if (!this->enabled_) {
     // we need to enable the power supply.
-    // cancel old timeout if it exists because we now definitely have a high power mode.
     ESP_LOGD(TAG, "Enabling power supply.");
+    this->pin_->digital_write(true);
     delay(this->enable_time_);
+    this->enabled_ = true;
   }
-  this->enabled_ = true;
   // increase active requests
   this->active_requests_++;
 }
@@ -66,10 +70,12 @@ void PowerSupplyComponent::unrequest_high_power() {
 
   if (this->active_requests_ == 0) {
     // set timeout for power supply off
+    this->off_pending_ = true;
     this->set_timeout("power-supply-off", this->keep_on_time_, [this]() {
       ESP_LOGD(TAG, "Disabling power supply.");
       this->pin_->digital_write(false);
       this->enabled_ = false;
+      this->off_pending_ = false;
     });
   }
 }
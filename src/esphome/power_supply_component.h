@@ -75,6 +75,8 @@ class PowerSupplyComponent : public Component {
   uint32_t enable_time_;
   uint32_t keep_on_time_;
   int16_t active_requests_{0};  // use signed integer to make catching negative requests easier.
+  /// Whether the power-supply-off timeout is scheduled.
+  bool off_pending_{false};
 };
 
 ESPHOME_NAMESPACE_END
@@ -55,8 +55,14 @@ void BH1750Sensor::dump_config() {
 }
 
 void BH1750Sensor::update() {
-  if (!this->write_bytes(this->resolution_, nullptr, 0))
+  uint32_t conversion_time;
+  if (!this->start_conversion(&conversion_time))
     return;
+  this->set_timeout("illuminance", conversion_time, [this]() { this->read_conversion(); });
+}
+bool BH1750Sensor::start_conversion(uint32_t *conversion_time) {
+  if (!this->write_bytes(this->resolution_, nullptr, 0))
+    return false;
 
   uint32_t wait = 0;
   // use max conversion times
@@ -69,14 +75,14 @@ void BH1750Sensor::update() {
       wait = 24;
       break;
   }
-
-  this->set_timeout("illuminance", wait, [this]() { this->read_data_(); });
+  *conversion_time = wait;
+  return true;
 }
 std::string BH1750Sensor::unit_of_measurement() { return UNIT_LX; }
 std::string BH1750Sensor::icon() { return ICON_BRIGHTNESS_5; }
 int8_t BH1750Sensor::accuracy_decimals() { return 1; }
 float BH1750Sensor::get_setup_priority() const { return setup_priority::HARDWARE_LATE; }
-void BH1750Sensor::read_data_() {
+void BH1750Sensor::read_conversion() {
   uint16_t raw_value;
   if (!this->parent_->raw_receive_16(this->address_, &raw_value, 1)) {
     this->status_set_warning();
@@ -20,7 +20,7 @@ enum BH1750Resolution {
 };
 
 /// This class implements support for the i2c-based BH1750 ambient light sensor.
-class BH1750Sensor : public PollingSensorComponent, public I2CDevice {
+class BH1750Sensor : public PollingSensorComponent, public I2CDevice, public I2CPollingDevice {
  public:
   BH1750Sensor(I2CComponent *parent, const std::string &name, uint8_t address = 0x23, uint32_t update_interval = 60000);
 
@@ -41,14 +41,14 @@ class BH1750Sensor : public PollingSensorComponent, public I2CDevice {
   void setup() override;
   void dump_config() override;
   void update() override;
+  bool start_conversion(uint32_t *conversion_time) override;
+  void read_conversion() override;
   float get_setup_priority() const override;
   std::string unit_of_measurement() override;
   std::string icon() override;
   int8_t accuracy_decimals() override;
 
  protected:
-  void read_data_();
-
   BH1750Resolution resolution_{BH1750_RESOLUTION_0P5_LX};
 };
 
@@ -187,6 +187,12 @@ float BME280Component::get_setup_priority() const { return setup_priority::HARDW
 inline uint8_t oversampling_to_time(BME280Oversampling over_sampling) { return (1 << uint8_t(over_sampling)) >> 1; }
 
 void BME280Component::update() {
+  uint32_t conversion_time;
+  if (!this->start_conversion(&conversion_time))
+    return;
+  this->set_timeout("data", conversion_time, [this]() { this->read_conversion(); });
+}
+bool BME280Component::start_conversion(uint32_t *conversion_time) {
   // Enable sensor
   ESP_LOGV(TAG, "Sending conversion request...");
   uint8_t meas_register = 0;
@@ -195,31 +201,32 @@ void BME280Component::update() {
   meas_register |= 0b01;  // Forced mode
   if (!this->write_byte(BME280_REGISTER_CONTROL, meas_register)) {
     this->status_set_warning();
-    return;
+    return false;
   }
 
   float meas_time = 1;
   meas_time += 2.3f * oversampling_to_time(this->temperature_oversampling_);
   meas_time += 2.3f * oversampling_to_time(this->pressure_oversampling_) + 0.575f;
   meas_time += 2.3f * oversampling_to_time(this->humidity_oversampling_) + 0.575f;
-
-  this->set_timeout("data", uint32_t(ceilf(meas_time)), [this]() {
-    int32_t t_fine = 0;
-    float temperature = this->read_temperature_(&t_fine);
-    if (isnan(temperature)) {
-      ESP_LOGW(TAG, "Invalid temperature, cannot read pressure & humidity values.");
-      this->status_set_warning();
-      return;
-    }
-    float pressure = this->read_pressure_(t_fine);
-    float humidity = this->read_humidity_(t_fine);
-
-    ESP_LOGD(TAG, "Got temperature=%.1f°C pressure=%.1fhPa humidity=%.1f%%", temperature, pressure, humidity);
-    this->temperature_sensor_->publish_state(temperature);
-    this->pressure_sensor_->publish_state(pressure);
-    this->humidity_sensor_->publish_state(humidity);
-    this->status_clear_warning();
-  });
+  *conversion_time = uint32_t(ceilf(meas_time));
+  return true;
+}
+void BME280Component::read_conversion() {
+  int32_t t_fine = 0;
+  float temperature = this->read_temperature_(&t_fine);
+  if (isnan(temperature)) {
+    ESP_LOGW(TAG, "Invalid temperature, cannot read pressure & humidity values.");
+    this->status_set_warning();
+    return;
+  }
+  float pressure = this->read_pressure_(t_fine);
+  float humidity = this->read_humidity_(t_fine);
+
+  ESP_LOGD(TAG, "Got temperature=%.1f°C pressure=%.1fhPa humidity=%.1f%%", temperature, pressure, humidity);
+  this->temperature_sensor_->publish_state(temperature);
+  this->pressure_sensor_->publish_state(pressure);
+  this->humidity_sensor_->publish_state(humidity);
+  this->status_clear_warning();
 }
 float BME280Component::read_temperature_(int32_t *t_fine) {
   uint8_t data[3];
@@ -67,7 +67,7 @@ using BME280PressureSensor = sensor::EmptyPollingParentSensor<1, ICON_GAUGE, UNI
 using BME280HumiditySensor = sensor::EmptyPollingParentSensor<1, ICON_WATER_PERCENT, UNIT_PERCENT>;
 
 /// This class implements support for the BME280 Temperature+Pressure+Humidity i2c sensor.
-class BME280Component : public PollingComponent, public I2CDevice {
+class BME280Component : public PollingComponent, public I2CDevice, public I2CPollingDevice {
  public:
   BME280Component(I2CComponent *parent, const std::string &temperature_name, const std::string &pressure_name,
                   const std::string &humidity_name, uint8_t address = 0x77, uint32_t update_interval = 60000);
@@ -91,6 +91,8 @@ class BME280Component : public PollingComponent, public I2CDevice {
   void dump_config() override;
   float get_setup_priority() const override;
   void update() override;
+  bool start_conversion(uint32_t *conversion_time) override;
+  void read_conversion() override;
 
  protected:
   /// Read the temperature value and store the calculated ambient temperature in t_fine.
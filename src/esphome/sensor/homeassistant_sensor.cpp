@@ -15,10 +15,10 @@ static const char *TAG = "sensor.homeassistant";
 HomeassistantSensor::HomeassistantSensor(const std::string &name, const std::string &entity_id)
     : Sensor(name), entity_id_(entity_id) {}
 void HomeassistantSensor::setup() {
-  api::global_api_server->subscribe_home_assistant_state(this->entity_id_, [this](std::string state) {
-    auto val = parse_float(state);
+  api::global_api_server->subscribe_home_assistant_state_view(this->entity_id_, [this](const api::StringView &state) {
+    auto val = state.parse_float();
     if (!val.has_value()) {
-      ESP_LOGW(TAG, "Can't convert '%s' to number!", state.c_str());
+      ESP_LOGW(TAG, "Can't convert '%.*s' to number!", int(state.length), state.data);
       this->publish_state(NAN);
       return;
     }
@@ -18,8 +18,12 @@ namespace sensor {
 static const char *TAG = "sensor.htu21d";
 static const uint8_t HTU21D_ADDRESS = 0x40;
 static const uint8_t HTU21D_REGISTER_RESET = 0xFE;
-static const uint8_t HTU21D_REGISTER_TEMPERATURE = 0xE3;
-static const uint8_t HTU21D_REGISTER_HUMIDITY = 0xE5;
+// "No hold master" commands, so the bus is free during the conversion
+static const uint8_t HTU21D_REGISTER_TEMPERATURE = 0xF3;
+static const uint8_t HTU21D_REGISTER_HUMIDITY = 0xF5;
+// max conversion times for 14-bit temperature and 12-bit humidity
+static const uint32_t HTU21D_TEMPERATURE_CONVERSION_TIME = 50;
+static const uint32_t HTU21D_HUMIDITY_CONVERSION_TIME = 16;
 static const uint8_t HTU21D_REGISTER_STATUS = 0xE7;
 
 HTU21DComponent::HTU21DComponent(I2CComponent *parent, const std::string &temperature_name,
@@ -50,16 +54,39 @@ void HTU21DComponent::dump_config() {
   LOG_SENSOR("  ", "Humidity", this->humidity_);
 }
 void HTU21DComponent::update() {
+  uint32_t conversion_time;
+  if (!this->start_conversion(&conversion_time))
+    return;
+  this->set_timeout("temperature", conversion_time, [this]() { this->read_conversion(); });
+}
+bool HTU21DComponent::start_conversion(uint32_t *conversion_time) {
+  if (!this->write_bytes(HTU21D_REGISTER_TEMPERATURE, nullptr, 0)) {
+    this->status_set_warning();
+    return false;
+  }
+  *conversion_time = HTU21D_TEMPERATURE_CONVERSION_TIME;
+  return true;
+}
+void HTU21DComponent::read_conversion() {
   uint16_t raw_temperature;
-  if (!this->read_byte_16(HTU21D_REGISTER_TEMPERATURE, &raw_temperature, 50)) {
+  if (!this->parent_->raw_receive_16(this->address_, &raw_temperature, 1)) {
     this->status_set_warning();
     return;
   }
 
   float temperature = (float(raw_temperature & 0xFFFC)) * 175.72f / 65536.0f - 46.85f;
 
+  // The HTU21D can only convert one value at a time, chain the humidity conversion
+  if (!this->write_bytes(HTU21D_REGISTER_HUMIDITY, nullptr, 0)) {
+    this->status_set_warning();
+    return;
+  }
+  this->set_timeout("humidity", HTU21D_HUMIDITY_CONVERSION_TIME,
+                    [this, temperature]() { this->read_humidity_(temperature); });
+}
+void HTU21DComponent::read_humidity_(float temperature) {
   uint16_t raw_humidity;
-  if (!this->read_byte_16(HTU21D_REGISTER_HUMIDITY, &raw_humidity, 50)) {
+  if (!this->parent_->raw_receive_16(this->address_, &raw_humidity, 1)) {
     this->status_set_warning();
     return;
   }
@@ -16,7 +16,7 @@ namespace sensor {
 using HTU21DTemperatureSensor = EmptyPollingParentSensor<1, ICON_EMPTY, UNIT_C>;
 using HTU21DHumiditySensor = EmptyPollingParentSensor<0, ICON_WATER_PERCENT, UNIT_PERCENT>;
 
-class HTU21DComponent : public PollingComponent, public I2CDevice {
+class HTU21DComponent : public PollingComponent, public I2CDevice, public I2CPollingDevice {
  public:
   /// Construct the HTU21D with the given update interval.
   HTU21DComponent(I2CComponent *parent, const std::string &temperature_name, const std::string &humidity_name,
@@ -34,10 +34,15 @@ class HTU21DComponent : public PollingComponent, public I2CDevice {
   void dump_config() override;
   /// Update the sensor values (temperature+humidity).
   void update() override;
+  /// Start the temperature conversion, read_conversion() then chains the humidity conversion.
+  bool start_conversion(uint32_t *conversion_time) override;
+  void read_conversion() override;
 
   float get_setup_priority() const override;
 
  protected:
+  void read_humidity_(float temperature);
+
   HTU21DTemperatureSensor *temperature_{nullptr};
   HTU21DHumiditySensor *humidity_{nullptr};
 };
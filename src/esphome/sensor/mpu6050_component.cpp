@@ -21,6 +21,24 @@ const uint8_t MPU6050_REGISTER_POWER_MANAGEMENT_1 = 0x6B;
 const uint8_t MPU6050_REGISTER_GYRO_CONFIG = 0x1B;
 const uint8_t MPU6050_REGISTER_ACCEL_CONFIG = 0x1C;
 const uint8_t MPU6050_REGISTER_ACCEL_XOUT_H = 0x3B;
+const uint8_t MPU6050_REGISTER_TEMP_OUT_H = 0x41;
+const uint8_t MPU6050_REGISTER_SMPLRT_DIV = 0x19;
+const uint8_t MPU6050_REGISTER_CONFIG = 0x1A;
+const uint8_t MPU6050_REGISTER_FIFO_EN = 0x23;
+const uint8_t MPU6050_REGISTER_INT_STATUS = 0x3A;
+const uint8_t MPU6050_REGISTER_USER_CTRL = 0x6A;
+const uint8_t MPU6050_REGISTER_FIFO_COUNT_H = 0x72;
+const uint8_t MPU6050_REGISTER_FIFO_R_W = 0x74;
+const uint8_t MPU6050_DLPF_CFG_44HZ = 0b011;
+/// XG_FIFO_EN | YG_FIFO_EN | ZG_FIFO_EN | ACCEL_FIFO_EN, gives 12 byte samples (accel xyz, gyro xyz).
+const uint8_t MPU6050_FIFO_EN_ACCEL_GYRO = 0b01111000;
+const uint8_t MPU6050_BIT_FIFO_EN = 6;
+const uint8_t MPU6050_BIT_FIFO_RESET = 2;
+const uint8_t MPU6050_BIT_FIFO_OFLOW_INT = 4;
+const uint16_t MPU6050_FIFO_SIZE = 1024;
+const uint8_t MPU6050_FIFO_SAMPLE_SIZE = 12;
+/// Bytes per I2C transaction, the ESP8266 Wire library can only buffer 32 bytes.
+const uint8_t MPU6050_FIFO_CHUNK_SIZE = 24;
 const uint8_t MPU6050_CLOCK_SOURCE_X_GYRO = 0b001;
 const uint8_t MPU6050_SCALE_2000_DPS = 0b11;
 const float MPU6050_SCALE_DPS_PER_DIGIT_2000 = 0.060975f;
@@ -89,11 +107,42 @@ void MPU6050Component::setup() {
   accel_config &= 0b11100111;
   accel_config |= (MPU6050_RANGE_2G << 3);
   ESP_LOGV(TAG, "    Output accel_config: 0b" BYTE_TO_BINARY_PATTERN, BYTE_TO_BINARY(accel_config));
-  if (!this->write_byte(MPU6050_REGISTER_GYRO_CONFIG, gyro_config)) {
+  if (!this->write_byte(MPU6050_REGISTER_ACCEL_CONFIG, accel_config)) {
+    this->mark_failed();
+    return;
+  }
+
+  if (this->sample_rate_ != 0 && !this->setup_fifo_()) {
     this->mark_failed();
     return;
   }
 }
+bool MPU6050Component::setup_fifo_() {
+  ESP_LOGV(TAG, "  Setting up FIFO...");
+  // Enable the digital low pass filter, gyro output rate is then 1kHz
+  if (!this->write_byte(MPU6050_REGISTER_CONFIG, MPU6050_DLPF_CFG_44HZ))
+    return false;
+  // Sample Rate = 1kHz / (1 + SMPLRT_DIV)
+  uint8_t divider = 1000 / this->sample_rate_ - 1;
+  ESP_LOGV(TAG, "    Sample rate divider: %u", divider);
+  if (!this->write_byte(MPU6050_REGISTER_SMPLRT_DIV, divider))
+    return false;
+  if (!this->write_byte(MPU6050_REGISTER_FIFO_EN, MPU6050_FIFO_EN_ACCEL_GYRO))
+    return false;
+  if (!this->reset_fifo_())
+    return false;
+
+  // Drain twice per FIFO fill time so that it never overflows, but don't touch the bus more often than
+  // every 10ms.
+  uint32_t fill_time = uint32_t(MPU6050_FIFO_SIZE / MPU6050_FIFO_SAMPLE_SIZE) * 1000 / this->sample_rate_;
+  this->drain_interval_ = std::max(fill_time / 2, uint32_t(10));
+  return true;
+}
+bool MPU6050Component::reset_fifo_() {
+  if (!this->write_byte(MPU6050_REGISTER_USER_CTRL, 1 << MPU6050_BIT_FIFO_RESET))
+    return false;
+  return this->write_byte(MPU6050_REGISTER_USER_CTRL, 1 << MPU6050_BIT_FIFO_EN);
+}
 void MPU6050Component::dump_config() {
   ESP_LOGCONFIG(TAG, "MPU6050:");
   LOG_I2C_DEVICE(this);
@@ -101,6 +150,11 @@ void MPU6050Component::dump_config() {
     ESP_LOGE(TAG, "Communication with MPU6050 failed!");
   }
   LOG_UPDATE_INTERVAL(this);
+  if (this->sample_rate_ != 0) {
+    ESP_LOGCONFIG(TAG, "  FIFO Sample Rate: %u Hz", this->sample_rate_);
+    ESP_LOGCONFIG(TAG, "  FIFO Drain Interval: %u ms", this->drain_interval_);
+    ESP_LOGCONFIG(TAG, "  Fusion Time Constant: %.2f s", this->fusion_time_constant_);
+  }
   LOG_SENSOR("  ", "Acceleration X", this->accel_x_sensor_);
   LOG_SENSOR("  ", "Acceleration Y", this->accel_y_sensor_);
   LOG_SENSOR("  ", "Acceleration Z", this->accel_z_sensor_);
@@ -108,25 +162,206 @@ void MPU6050Component::dump_config() {
   LOG_SENSOR("  ", "Gyro Y", this->gyro_y_sensor_);
   LOG_SENSOR("  ", "Gyro Z", this->gyro_z_sensor_);
   LOG_SENSOR("  ", "Temperature", this->temperature_sensor_);
+  LOG_SENSOR("  ", "Roll", this->roll_sensor_);
+  LOG_SENSOR("  ", "Pitch", this->pitch_sensor_);
+  LOG_SENSOR("  ", "Vibration", this->vibration_sensor_);
+  LOG_SENSOR("  ", "Peak Acceleration", this->peak_acceleration_sensor_);
+}
+
+void MPU6050Component::loop() {
+  if (this->sample_rate_ == 0)
+    return;
+  uint32_t now = millis();
+  if (now - this->last_drain_ < this->drain_interval_)
+    return;
+  this->last_drain_ = now;
+  this->drain_fifo_();
+}
+void MPU6050Component::drain_fifo_() {
+  uint8_t int_status;
+  if (!this->read_byte(MPU6050_REGISTER_INT_STATUS, &int_status)) {
+    this->status_set_warning();
+    return;
+  }
+  uint16_t count;
+  if (!this->read_byte_16(MPU6050_REGISTER_FIFO_COUNT_H, &count)) {
+    this->status_set_warning();
+    return;
+  }
+  if ((int_status & (1 << MPU6050_BIT_FIFO_OFLOW_INT)) || count >= MPU6050_FIFO_SIZE) {
+    // The FIFO has wrapped around, sample boundaries are lost
+    this->fifo_overflows_++;
+    ESP_LOGW(TAG, "FIFO overflowed (%u times total), resetting!", this->fifo_overflows_);
+    if (!this->reset_fifo_())
+      this->status_set_warning();
+    return;
+  }
+
+  uint16_t samples = count / MPU6050_FIFO_SAMPLE_SIZE;
+  uint16_t remaining = samples * MPU6050_FIFO_SAMPLE_SIZE;
+  uint16_t read_samples = 0;
+  uint8_t buffer[MPU6050_FIFO_CHUNK_SIZE];
+  while (remaining > 0) {
+    uint8_t len = std::min(remaining, uint16_t(MPU6050_FIFO_CHUNK_SIZE));
+    if (!this->read_bytes(MPU6050_REGISTER_FIFO_R_W, buffer, len)) {
+      this->status_set_warning();
+      // Whatever we did read is still valid, but the FIFO is no longer aligned to sample boundaries.
+      if (read_samples > 0)
+        this->fuse_burst_(read_samples);
+      this->reset_fifo_();
+      return;
+    }
+    for (uint8_t off = 0; off < len; off += MPU6050_FIFO_SAMPLE_SIZE) {
+      const uint8_t *p = buffer + off;
+      uint32_t magnitude_sq = 0;
+      for (int i = 0; i < 3; i++) {
+        int32_t accel = int16_t((p[i * 2] << 8) | p[i * 2 + 1]);
+        int32_t gyro = int16_t((p[6 + i * 2] << 8) | p[6 + i * 2 + 1]);
+        this->burst_accel_[i] += accel;
+        this->burst_gyro_[i] += gyro;
+        this->window_accel_sq_[i] += accel * accel;
+        magnitude_sq += accel * accel;
+      }
+      if (magnitude_sq > this->window_peak_sq_)
+        this->window_peak_sq_ = magnitude_sq;
+    }
+    read_samples += len / MPU6050_FIFO_SAMPLE_SIZE;
+    remaining -= len;
+  }
+  if (read_samples > 0)
+    this->fuse_burst_(read_samples);
+}
+void MPU6050Component::fuse_burst_(uint16_t samples) {
+  // Gyro integration is linear, so integrating the summed raw counts once per burst is exactly the same as
+  // integrating each sample.
+  const float dt = 1.0f / this->sample_rate_;
+  const float burst_dt = samples * dt;
+  const float ax = this->burst_accel_[0];
+  const float ay = this->burst_accel_[1];
+  const float az = this->burst_accel_[2];
+  const float accel_roll = atan2f(ay, az) * 180.0f / M_PI;
+  const float accel_pitch = atan2f(-ax, sqrtf(ay * ay + az * az)) * 180.0f / M_PI;
+
+  if (!this->orientation_valid_) {
+    this->roll_ = accel_roll;
+    this->pitch_ = accel_pitch;
+    this->orientation_valid_ = true;
+  } else {
+    // Complementary filter, the gyro tracks fast motion and the accelerometer's gravity vector (averaged
+    // over the burst) slowly pulls out the gyro drift.
+    const float alpha = this->fusion_time_constant_ / (this->fusion_time_constant_ + burst_dt);
+    const float gyro_scale = MPU6050_SCALE_DPS_PER_DIGIT_2000 * dt;
+    this->roll_ = alpha * (this->roll_ + this->burst_gyro_[0] * gyro_scale) + (1.0f - alpha) * accel_roll;
+    this->pitch_ = alpha * (this->pitch_ + this->burst_gyro_[1] * gyro_scale) + (1.0f - alpha) * accel_pitch;
+  }
+
+  for (int i = 0; i < 3; i++) {
+    this->window_accel_[i] += this->burst_accel_[i];
+    this->window_gyro_[i] += this->burst_gyro_[i];
+    this->burst_accel_[i] = 0;
+    this->burst_gyro_[i] = 0;
+  }
+  this->window_samples_ += samples;
 }
 
 void MPU6050Component::update() {
   ESP_LOGV(TAG, "    Updating MPU6050...");
+  if (this->sample_rate_ != 0) {
+    this->update_fifo_();
+  } else {
+    this->update_snapshot_();
+  }
+}
+void MPU6050Component::update_fifo_() {
+  // Pick up everything sampled up until now
+  this->drain_fifo_();
+  this->last_drain_ = millis();
+
+  uint16_t raw_temperature;
+  if (!this->read_byte_16(MPU6050_REGISTER_TEMP_OUT_H, &raw_temperature)) {
+    this->status_set_warning();
+    return;
+  }
+  float temperature = int16_t(raw_temperature) / 340.0f + 36.53f;
+  if (this->temperature_sensor_ != nullptr)
+    this->temperature_sensor_->publish_state(temperature);
+
+  const uint32_t n = this->window_samples_;
+  if (n == 0) {
+    ESP_LOGW(TAG, "No FIFO samples since last update!");
+    this->status_set_warning();
+    return;
+  }
+
+  const float accel_scale = MPU6050_RANGE_PER_DIGIT_2G * GRAVITY_EARTH;
+  float accel[3], gyro[3];
+  float variance = 0.0f;
+  for (int i = 0; i < 3; i++) {
+    float mean = float(this->window_accel_[i]) / n;
+    variance += float(this->window_accel_sq_[i]) / n - mean * mean;
+    accel[i] = mean * accel_scale;
+    gyro[i] = float(this->window_gyro_[i]) / n * MPU6050_SCALE_DPS_PER_DIGIT_2000;
+  }
+  // RMS of the acceleration around its mean, i.e. with gravity and slow tilt removed
+  float vibration = sqrtf(std::max(variance, 0.0f)) * accel_scale;
+  float peak = sqrtf(float(this->window_peak_sq_)) * accel_scale;
+
+  ESP_LOGD(TAG,
+           "Got %u samples: accel={x=%.3f m/s², y=%.3f m/s², z=%.3f m/s²}, "
+           "gyro={x=%.3f °/s, y=%.3f °/s, z=%.3f °/s}, roll=%.1f°, pitch=%.1f°, vibration=%.3f m/s², "
+           "peak=%.3f m/s², temp=%.3f°C",
+           n, accel[0], accel[1], accel[2], gyro[0], gyro[1], gyro[2], this->roll_, this->pitch_, vibration, peak,
+           temperature);
+
+  for (int i = 0; i < 3; i++) {
+    this->window_accel_[i] = 0;
+    this->window_accel_sq_[i] = 0;
+    this->window_gyro_[i] = 0;
+  }
+  this->window_peak_sq_ = 0;
+  this->window_samples_ = 0;
+
+  if (this->accel_x_sensor_ != nullptr)
+    this->accel_x_sensor_->publish_state(accel[0]);
+  if (this->accel_y_sensor_ != nullptr)
+    this->accel_y_sensor_->publish_state(accel[1]);
+  if (this->accel_z_sensor_ != nullptr)
+    this->accel_z_sensor_->publish_state(accel[2]);
+
+  if (this->gyro_x_sensor_ != nullptr)
+    this->gyro_x_sensor_->publish_state(gyro[0]);
+  if (this->gyro_y_sensor_ != nullptr)
+    this->gyro_y_sensor_->publish_state(gyro[1]);
+  if (this->gyro_z_sensor_ != nullptr)
+    this->gyro_z_sensor_->publish_state(gyro[2]);
+
+  if (this->roll_sensor_ != nullptr)
+    this->roll_sensor_->publish_state(this->roll_);
+  if (this->pitch_sensor_ != nullptr)
+    this->pitch_sensor_->publish_state(this->pitch_);
+  if (this->vibration_sensor_ != nullptr)
+    this->vibration_sensor_->publish_state(vibration);
+  if (this->peak_acceleration_sensor_ != nullptr)
+    this->peak_acceleration_sensor_->publish_state(peak);
+
+  this->status_clear_warning();
+}
+void MPU6050Component::update_snapshot_() {
   uint16_t data[7];
   if (!this->read_bytes_16(MPU6050_REGISTER_ACCEL_XOUT_H, data, 7)) {
     this->status_set_warning();
     return;
   }
 
-  float accel_x = data[0] * MPU6050_RANGE_PER_DIGIT_2G * GRAVITY_EARTH;
-  float accel_y = data[1] * MPU6050_RANGE_PER_DIGIT_2G * GRAVITY_EARTH;
-  float accel_z = data[2] * MPU6050_RANGE_PER_DIGIT_2G * GRAVITY_EARTH;
+  float accel_x = int16_t(data[0]) * MPU6050_RANGE_PER_DIGIT_2G * GRAVITY_EARTH;
+  float accel_y = int16_t(data[1]) * MPU6050_RANGE_PER_DIGIT_2G * GRAVITY_EARTH;
+  float accel_z = int16_t(data[2]) * MPU6050_RANGE_PER_DIGIT_2G * GRAVITY_EARTH;
 
-  float temperature = data[3] / 340.0f + 36.53f;
+  float temperature = int16_t(data[3]) / 340.0f + 36.53f;
 
-  float gyro_x = data[4] * MPU6050_SCALE_DPS_PER_DIGIT_2000;
-  float gyro_y = data[5] * MPU6050_SCALE_DPS_PER_DIGIT_2000;
-  float gyro_z = data[6] * MPU6050_SCALE_DPS_PER_DIGIT_2000;
+  float gyro_x = int16_t(data[4]) * MPU6050_SCALE_DPS_PER_DIGIT_2000;
+  float gyro_y = int16_t(data[5]) * MPU6050_SCALE_DPS_PER_DIGIT_2000;
+  float gyro_z = int16_t(data[6]) * MPU6050_SCALE_DPS_PER_DIGIT_2000;
 
   ESP_LOGD(TAG,
            "Got accel={x=%.3f m/s², y=%.3f m/s², z=%.3f m/s²}, "
@@ -173,6 +408,26 @@ MPU6050GyroSensor *MPU6050Component::make_gyro_z_sensor(const std::string &name)
 MPU6050TemperatureSensor *MPU6050Component::make_temperature_sensor(const std::string &name) {
   return this->temperature_sensor_ = new MPU6050TemperatureSensor(name, this);
 }
+MPU6050OrientationSensor *MPU6050Component::make_roll_sensor(const std::string &name) {
+  return this->roll_sensor_ = new MPU6050OrientationSensor(name, this);
+}
+MPU6050OrientationSensor *MPU6050Component::make_pitch_sensor(const std::string &name) {
+  return this->pitch_sensor_ = new MPU6050OrientationSensor(name, this);
+}
+MPU6050VibrationSensor *MPU6050Component::make_vibration_sensor(const std::string &name) {
+  return this->vibration_sensor_ = new MPU6050VibrationSensor(name, this);
+}
+MPU6050VibrationSensor *MPU6050Component::make_peak_acceleration_sensor(const std::string &name) {
+  return this->peak_acceleration_sensor_ = new MPU6050VibrationSensor(name, this);
+}
+void MPU6050Component::set_sample_rate(uint16_t sample_rate) {
+  if (sample_rate != 0)
+    sample_rate = clamp<uint16_t>(4, 1000, sample_rate);
+  this->sample_rate_ = sample_rate;
+}
+void MPU6050Component::set_fusion_time_constant(float fusion_time_constant) {
+  this->fusion_time_constant_ = fusion_time_constant;
+}
 float MPU6050Component::get_setup_priority() const { return setup_priority::HARDWARE_LATE; }
 
 }  // namespace sensor
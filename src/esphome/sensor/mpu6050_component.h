@@ -16,6 +16,8 @@ namespace sensor {
 using MPU6050AccelSensor = EmptyPollingParentSensor<2, ICON_BRIEFCASE_DOWNLOAD, UNIT_M_PER_S_SQUARED>;
 using MPU6050GyroSensor = EmptyPollingParentSensor<2, ICON_SCREEN_ROTATION, UNIT_DEGREES_PER_SECOND>;
 using MPU6050TemperatureSensor = EmptyPollingParentSensor<1, ICON_EMPTY, UNIT_C>;
+using MPU6050OrientationSensor = EmptyPollingParentSensor<1, ICON_SCREEN_ROTATION, UNIT_DEGREES>;
+using MPU6050VibrationSensor = EmptyPollingParentSensor<3, ICON_BRIEFCASE_DOWNLOAD, UNIT_M_PER_S_SQUARED>;
 
 class MPU6050Component : public PollingComponent, public I2CDevice {
  public:
@@ -26,8 +28,23 @@ class MPU6050Component : public PollingComponent, public I2CDevice {
 
   void update() override;
 
+  /// Drain the FIFO if FIFO mode is enabled, see set_sample_rate().
+  void loop() override;
+
   float get_setup_priority() const override;
 
+  /** Enable FIFO mode with the given internal sample rate in Hz (4-1000).
+   *
+   * In FIFO mode the MPU6050 samples accelerometer and gyroscope data into its 1024 byte FIFO at this rate.
+   * The FIFO is drained in bursts from loop() and the samples are fused into an orientation estimate
+   * (complementary filter) and vibration statistics. All sensors are then published at the update interval
+   * with values aggregated over that window (accel/gyro sensors get the window mean). 0 (the default) disables
+   * the FIFO and publishes a single snapshot per update interval.
+   */
+  void set_sample_rate(uint16_t sample_rate);
+  /// Set the time constant in seconds of the complementary filter, higher values trust the gyroscope more.
+  void set_fusion_time_constant(float fusion_time_constant);
+
   MPU6050AccelSensor *make_accel_x_sensor(const std::string &name);
   MPU6050AccelSensor *make_accel_y_sensor(const std::string &name);
   MPU6050AccelSensor *make_accel_z_sensor(const std::string &name);
@@ -35,8 +52,38 @@ class MPU6050Component : public PollingComponent, public I2CDevice {
   MPU6050GyroSensor *make_gyro_y_sensor(const std::string &name);
   MPU6050GyroSensor *make_gyro_z_sensor(const std::string &name);
   MPU6050TemperatureSensor *make_temperature_sensor(const std::string &name);
+  MPU6050OrientationSensor *make_roll_sensor(const std::string &name);
+  MPU6050OrientationSensor *make_pitch_sensor(const std::string &name);
+  MPU6050VibrationSensor *make_vibration_sensor(const std::string &name);
+  MPU6050VibrationSensor *make_peak_acceleration_sensor(const std::string &name);
 
  protected:
+  bool setup_fifo_();
+  bool reset_fifo_();
+  void drain_fifo_();
+  void fuse_burst_(uint16_t samples);
+  void update_fifo_();
+  void update_snapshot_();
+
+  uint16_t sample_rate_{0};
+  float fusion_time_constant_{0.5f};
+  uint32_t drain_interval_{0};
+  uint32_t last_drain_{0};
+  uint32_t fifo_overflows_{0};
+
+  /// Accumulators for the current burst, integer only so the per-sample cost stays low.
+  int32_t burst_accel_[3]{};
+  int32_t burst_gyro_[3]{};
+  /// Accumulators for the current publish window.
+  int64_t window_accel_[3]{};
+  int64_t window_accel_sq_[3]{};
+  int64_t window_gyro_[3]{};
+  uint32_t window_peak_sq_{0};
+  uint32_t window_samples_{0};
+  bool orientation_valid_{false};
+  float roll_{0.0f};
+  float pitch_{0.0f};
+
   MPU6050AccelSensor *accel_x_sensor_{nullptr};
   MPU6050AccelSensor *accel_y_sensor_{nullptr};
   MPU6050AccelSensor *accel_z_sensor_{nullptr};
@@ -44,6 +91,10 @@ class MPU6050Component : public PollingComponent, public I2CDevice {
   MPU6050GyroSensor *gyro_x_sensor_{nullptr};
   MPU6050GyroSensor *gyro_y_sensor_{nullptr};
   MPU6050GyroSensor *gyro_z_sensor_{nullptr};
+  MPU6050OrientationSensor *roll_sensor_{nullptr};
+  MPU6050OrientationSensor *pitch_sensor_{nullptr};
+  MPU6050VibrationSensor *vibration_sensor_{nullptr};
+  MPU6050VibrationSensor *peak_acceleration_sensor_{nullptr};
 };
 
 }  // namespace sensor
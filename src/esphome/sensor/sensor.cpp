@@ -38,10 +38,6 @@ void Sensor::set_unit_of_measurement(const std::string &unit_of_measurement) {
 }
 void Sensor::set_icon(const std::string &icon) { this->icon_ = icon; }
 void Sensor::set_accuracy_decimals(int8_t accuracy_decimals) { this->accuracy_decimals_ = accuracy_decimals; }
-void Sensor::add_on_state_callback(std::function<void(float)> &&callback) { this->callback_.add(std::move(callback)); }
-void Sensor::add_on_raw_state_callback(std::function<void(float)> &&callback) {
-  this->raw_callback_.add(std::move(callback));
-}
 std::string Sensor::get_icon() {
   if (this->icon_.has_value())
     return *this->icon_;
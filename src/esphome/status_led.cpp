@@ -16,18 +16,43 @@ void StatusLEDComponent::setup() {
   ESP_LOGCONFIG(TAG, "Setting up Status LED...");
   this->pin_->setup();
   this->pin_->digital_write(false);
+  this->led_on_ = false;
 }
 void StatusLEDComponent::dump_config() {
   ESP_LOGCONFIG(TAG, "Status LED:");
   LOG_PIN("  Pin: ", this->pin_);
 }
 void StatusLEDComponent::loop() {
-  if ((global_state & STATUS_LED_ERROR) != 0u) {
-    this->pin_->digital_write(millis() % 250u < 150u);
-  } else if ((global_state & STATUS_LED_WARNING) != 0u) {
-    this->pin_->digital_write(millis() % 1500u < 250u);
+  // global_state is assigned directly by the application and OTA, so it's polled: one load and compare when idle
+  const uint32_t state = global_state & (STATUS_LED_ERROR | STATUS_LED_WARNING);
+  const uint32_t now = millis();
+  if (state == this->state_ && int32_t(now - this->next_edge_) < 0)
+    return;
+  this->state_ = state;
+
+  uint32_t period, on_time;
+  if ((state & STATUS_LED_ERROR) != 0u) {
+    period = 250;
+    on_time = 150;
+  } else if ((state & STATUS_LED_WARNING) != 0u) {
+    period = 1500;
+    on_time = 250;
   } else {
-    this->pin_->digital_write(false);
+    // Nothing to blink, only a status change can wake us up again
+    this->next_edge_ = now + 0x7FFFFFFFUL;
+    if (this->led_on_) {
+      this->pin_->digital_write(false);
+      this->led_on_ = false;
+    }
+    return;
+  }
+
+  const uint32_t phase = now % period;
+  const bool on = phase < on_time;
+  this->next_edge_ = now + (on ? on_time : period) - phase;
+  if (on != this->led_on_) {
+    this->pin_->digital_write(on);
+    this->led_on_ = on;
   }
 }
 float StatusLEDComponent::get_setup_priority() const { return setup_priority::HARDWARE; }
@@ -22,6 +22,11 @@ class StatusLEDComponent : public Component {
 
  protected:
   GPIOPin *pin_;
+  /// The status bits the current blink pattern was computed for.
+  uint32_t state_{0xFFFFFFFF};
+  /// The next time the LED needs to change, loop() does nothing before that unless the status changes.
+  uint32_t next_edge_{0};
+  bool led_on_{false};
 };
 
 extern StatusLEDComponent *global_status_led;
@@ -17,6 +17,14 @@ float GPIOSwitch::get_setup_priority() const { return setup_priority::HARDWARE;
 void GPIOSwitch::setup() {
   ESP_LOGCONFIG(TAG, "Setting up GPIO Switch '%s'...", this->name_.c_str());
 
+  if (this->group_ != nullptr) {
+    // keep the pin off, the group restores the states once all of its pins are set up
+    this->pin_->digital_write(this->inverted_);
+    this->pin_->setup();
+    this->pin_->digital_write(this->inverted_);
+    return;
+  }
+
   bool initial_state = false;
   switch (this->restore_mode_) {
     case GPIO_SWITCH_RESTORE_DEFAULT_OFF:
@@ -74,6 +82,11 @@ void GPIOSwitch::dump_config() {
   }
 }
 void GPIOSwitch::write_state(bool state) {
+  if (this->group_ != nullptr) {
+    this->group_->write_state_(this, state != this->inverted_);
+    return;
+  }
+
   if (state != this->inverted_) {
     // Turning ON, check interlocking
     for (auto *lock : this->interlock_) {
@@ -91,6 +104,142 @@ void GPIOSwitch::write_state(bool state) {
 void GPIOSwitch::set_restore_mode(GPIOSwitchRestoreMode restore_mode) { this->restore_mode_ = restore_mode; }
 void GPIOSwitch::set_interlock(const std::vector<Switch *> &interlock) { this->interlock_ = interlock; }
 
+GPIOSwitchGroup::GPIOSwitchGroup(const std::vector<GPIOSwitch *> &switches) : switches_(switches) {
+  // the states are stored in a 32-bit mask
+  if (this->switches_.size() > 32)
+    this->switches_.resize(32);
+  for (uint8_t i = 0; i < this->switches_.size(); i++) {
+    this->switches_[i]->group_ = this;
+    this->switches_[i]->group_index_ = i;
+  }
+}
+void GPIOSwitchGroup::set_interlock(bool interlock) { this->interlock_ = interlock; }
+void GPIOSwitchGroup::set_dead_time(uint32_t dead_time) { this->dead_time_ = dead_time; }
+uint32_t GPIOSwitchGroup::get_state() const { return this->state_; }
+float GPIOSwitchGroup::get_setup_priority() const { return setup_priority::HARDWARE - 1.0f; }
+void GPIOSwitchGroup::setup() {
+  ESP_LOGCONFIG(TAG, "Setting up GPIO Switch Group...");
+  std::string key = "gpio_switch_group";
+  for (auto *a_switch : this->switches_)
+    key += a_switch->get_object_id();
+  this->rtc_ = global_preferences.make_preference<uint32_t>(fnv1_hash(key));
+  uint32_t restored = 0;
+  const bool has_restored = this->rtc_.load(&restored);
+
+  uint32_t initial_state = 0;
+  for (uint8_t i = 0; i < this->switches_.size(); i++) {
+    bool on = false;
+    switch (this->switches_[i]->restore_mode_) {
+      case GPIO_SWITCH_RESTORE_DEFAULT_OFF:
+        on = has_restored ? (restored >> i) & 1 : false;
+        break;
+      case GPIO_SWITCH_RESTORE_DEFAULT_ON:
+        on = has_restored ? (restored >> i) & 1 : true;
+        break;
+      case GPIO_SWITCH_ALWAYS_OFF:
+        on = false;
+        break;
+      case GPIO_SWITCH_ALWAYS_ON:
+        on = true;
+        break;
+    }
+    if (on)
+      initial_state |= 1UL << i;
+  }
+  if (this->interlock_) {
+    // only keep the first switch that's on
+    initial_state &= ~initial_state + 1;
+  }
+
+  // the switches haven't published a state yet, so publish all of them
+  this->state_ = ~initial_state;
+  this->apply_(initial_state);
+}
+void GPIOSwitchGroup::dump_config() {
+  ESP_LOGCONFIG(TAG, "GPIO Switch Group:");
+  ESP_LOGCONFIG(TAG, "  Interlock: %s", YESNO(this->interlock_));
+  if (this->interlock_)
+    ESP_LOGCONFIG(TAG, "  Dead Time: %u ms", this->dead_time_);
+  ESP_LOGCONFIG(TAG, "  Switches:");
+  for (auto *a_switch : this->switches_)
+    ESP_LOGCONFIG(TAG, "    %s", a_switch->get_name().c_str());
+}
+void GPIOSwitchGroup::write_state_(GPIOSwitch *a_switch, bool state) {
+  const uint32_t bit = 1UL << a_switch->group_index_;
+  if (this->pending_on_ != 0 && (state || this->pending_on_ == bit)) {
+    // a newer request replaces the switch that's waiting for the dead time
+    this->cancel_timeout("dead_time");
+    this->pending_on_ = 0;
+  }
+
+  if (!state) {
+    this->apply_(this->state_ & ~bit);
+    return;
+  }
+  if (!this->interlock_) {
+    this->apply_(this->state_ | bit);
+    return;
+  }
+  if (this->dead_time_ == 0) {
+    // turn the others off and this switch on with the same register write
+    this->apply_(bit);
+    return;
+  }
+  if (this->state_ == bit)
+    return;
+
+  this->apply_(0);
+  const uint32_t since_off = millis() - this->last_off_;
+  if (since_off >= this->dead_time_) {
+    this->apply_(bit);
+    return;
+  }
+  ESP_LOGD(TAG, "'%s' Waiting %u ms for the dead time.", a_switch->get_name().c_str(), this->dead_time_ - since_off);
+  this->pending_on_ = bit;
+  this->set_timeout("dead_time", this->dead_time_ - since_off, [this]() {
+    const uint32_t pending = this->pending_on_;
+    this->pending_on_ = 0;
+    this->apply_(pending);
+  });
+}
+void GPIOSwitchGroup::apply_(uint32_t new_state) {
+  const uint32_t changed = new_state ^ this->state_;
+  if (changed == 0)
+    return;
+
+  // Write everything that turns off before anything that turns on. Within a batch the order isn't defined
+  // (set/clear registers, several ports, pins that are written directly), so an interlock needs two of them.
+  const uint32_t turned_off = changed & this->state_;
+  const uint32_t turned_on = changed & new_state;
+  this->write_pins_(turned_off, false);
+  this->write_pins_(turned_on, true);
+  if (turned_off != 0)
+    this->last_off_ = millis();
+  this->state_ = new_state;
+
+  for (uint8_t i = 0; i < this->switches_.size(); i++) {
+    if ((changed >> i) & 1) {
+      GPIOSwitch *a_switch = this->switches_[i];
+      a_switch->publish_state(((new_state >> i) & 1) != a_switch->inverted_);
+    }
+  }
+  this->state_callback_.call(new_state);
+  this->rtc_.save_deferred(&new_state);
+}
+void GPIOSwitchGroup::write_pins_(uint32_t mask, bool state) {
+  if (mask == 0)
+    return;
+
+  GPIOBatchWrite batch;
+  for (uint8_t i = 0; i < this->switches_.size(); i++) {
+    if ((mask >> i) & 1) {
+      GPIOSwitch *a_switch = this->switches_[i];
+      batch.add(a_switch->pin_, state != a_switch->inverted_);
+    }
+  }
+  batch.apply();
+}
+
 }  // namespace switch_
 
 ESPHOME_NAMESPACE_END
@@ -20,6 +20,8 @@ enum GPIOSwitchRestoreMode {
   GPIO_SWITCH_ALWAYS_ON,
 };
 
+class GPIOSwitchGroup;
+
 class GPIOSwitch : public Switch, public Component {
  public:
   GPIOSwitch(const std::string &name, GPIOPin *pin);
@@ -35,11 +37,69 @@ class GPIOSwitch : public Switch, public Component {
   void set_interlock(const std::vector<Switch *> &interlock);
 
  protected:
+  friend GPIOSwitchGroup;
+
   void write_state(bool state) override;
 
   GPIOPin *const pin_;
   GPIOSwitchRestoreMode restore_mode_{GPIO_SWITCH_RESTORE_DEFAULT_OFF};
   std::vector<Switch *> interlock_;
+  GPIOSwitchGroup *group_{nullptr};
+  uint8_t group_index_{0};
+};
+
+/** A group of GPIO switches that change state together, for example the up/down relays of a shutter.
+ *
+ * With interlocking, at most one switch of the group is on: turning a switch on first turns the others off and
+ * then waits for the dead time before the new switch is turned on. All pins that turn off in a transition are
+ * written first, then all pins that turn on, each with one register write per GPIO port (see GPIOBatchWrite).
+ * The switches publish their states only after all pins were written. The states of all switches are saved
+ * together in one restore state.
+ *
+ * The switches of a group don't restore their state individually, the restore mode of each switch is applied
+ * by the group.
+ */
+class GPIOSwitchGroup : public Component {
+ public:
+  explicit GPIOSwitchGroup(const std::vector<GPIOSwitch *> &switches);
+
+  /// Set whether at most one switch of this group can be on at the same time, defaults to true.
+  void set_interlock(bool interlock);
+  /// Set the time in ms between turning a switch off and turning another one on, only used with interlocking.
+  void set_dead_time(uint32_t dead_time);
+
+  /// Add a callback that's called once per transition with a bitmask of the states of all switches.
+  template<typename F> void add_on_state_callback(F &&callback) {
+    this->state_callback_.add(std::forward<F>(callback));
+  }
+  /// Get a bitmask of the states of all switches, bit i is the state of the i-th switch.
+  uint32_t get_state() const;
+
+  // ========== INTERNAL METHODS ==========
+  // (In most use cases you won't need these)
+  void setup() override;
+  void dump_config() override;
+  float get_setup_priority() const override;
+
+ protected:
+  friend GPIOSwitch;
+
+  /// Request a state for a switch of this group.
+  void write_state_(GPIOSwitch *a_switch, bool state);
+  /// Write the pins of all switches whose state differs from new_state, then publish and save the new states.
+  void apply_(uint32_t new_state);
+  /// Write the (logical) state to the pins of the switches in mask with one GPIOBatchWrite.
+  void write_pins_(uint32_t mask, bool state);
+
+  std::vector<GPIOSwitch *> switches_;
+  bool interlock_{true};
+  uint32_t dead_time_{0};
+  uint32_t state_{0};
+  /// The switch waiting for the dead time to pass, 0 if none.
+  uint32_t pending_on_{0};
+  uint32_t last_off_{0};
+  CallbackManager<void(uint32_t)> state_callback_{};
+  ESPPreferenceObject rtc_;
 };
 
 }  // namespace switch_
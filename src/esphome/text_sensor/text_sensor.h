@@ -40,7 +40,7 @@ class TextSensor : public Nameable {
 
   void set_icon(const std::string &icon);
 
-  void add_on_state_callback(std::function<void(std::string)> callback);
+  template<typename F> void add_on_state_callback(F &&callback) { this->callback_.add(std::forward<F>(callback)); }
 
   std::string state;
 
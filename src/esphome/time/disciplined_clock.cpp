@@ -0,0 +1,89 @@
+#include "esphome/defines.h"
+
+#ifdef USE_TIME
+
+#include "esphome/time/disciplined_clock.h"
+#include "esphome/esphal.h"
+#include "esphome/helpers.h"
+#include "esphome/log.h"
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace time {
+
+static const char *TAG = "time.clock";
+
+/// Errors larger than this (in ms) step the clock instead of slewing it.
+static const int32_t STEP_THRESHOLD = 1000;
+/// Slew in 1ms of correction every this many ms, i.e. the clock runs at most 5% fast or slow.
+static const uint32_t SLEW_DIVIDER = 20;
+/// Estimate the drift only from syncs that are at least this far apart (in ms), jitter dominates otherwise.
+static const uint32_t MIN_DRIFT_INTERVAL = 60000;
+/// How much of the drift measured at each sync goes into the estimate.
+static const float DRIFT_GAIN = 0.5f;
+/// Crystals are never off by more than this (in ppm), larger estimates come from bad samples.
+static const float MAX_DRIFT_PPM = 1000.0f;
+/// A lower ranked source is ignored for this long (in ms) after a higher ranked one has synced.
+static const uint32_t SOURCE_HOLDOVER = 60 * 60 * 1000;
+
+void DisciplinedClock::synchronize(uint64_t epoch_ms, TimeSource source) {
+  const uint64_t monotonic = this->monotonic_ms_();
+  const uint64_t since_sync = monotonic - this->last_sync_;
+  if (source < this->source_ && since_sync < SOURCE_HOLDOVER) {
+    ESP_LOGV(TAG, "Ignoring time from source %u, source %u is in use", source, this->source_);
+    return;
+  }
+
+  const uint64_t predicted = this->epoch_at_(monotonic);
+  const int64_t error = int64_t(epoch_ms) - int64_t(predicted);
+  if (this->source_ == TIME_SOURCE_NONE || error > STEP_THRESHOLD || error < -STEP_THRESHOLD) {
+    ESP_LOGD(TAG, "Stepping clock by %lld ms", this->source_ == TIME_SOURCE_NONE ? 0ll : (long long) error);
+    this->ref_monotonic_ = monotonic;
+    this->ref_epoch_ = epoch_ms;
+    this->slew_ = 0;
+  } else {
+    if (source == this->source_ && since_sync >= MIN_DRIFT_INTERVAL) {
+      // the part of the error that isn't a leftover of the last correction comes from the oscillator
+      const uint64_t elapsed = monotonic - this->ref_monotonic_;
+      const int32_t slewed = std::min<uint64_t>(std::abs(this->slew_), elapsed / SLEW_DIVIDER);
+      const int32_t pending = this->slew_ < 0 ? this->slew_ + slewed : this->slew_ - slewed;
+      const float measured = (error - pending) * 1e6f / since_sync;
+      this->drift_ppm_ = clamp(-MAX_DRIFT_PPM, MAX_DRIFT_PPM, this->drift_ppm_ + measured * DRIFT_GAIN);
+    }
+    ESP_LOGV(TAG, "Slewing clock by %lld ms, drift %.1f ppm", (long long) error, this->drift_ppm_);
+    this->ref_monotonic_ = monotonic;
+    this->ref_epoch_ = predicted;
+    this->slew_ = error;
+  }
+  this->last_sync_ = monotonic;
+  this->source_ = source;
+}
+bool DisciplinedClock::is_synchronized() const { return this->source_ != TIME_SOURCE_NONE; }
+uint64_t DisciplinedClock::get_epoch_ms() {
+  if (!this->is_synchronized())
+    return 0;
+  return this->epoch_at_(this->monotonic_ms_());
+}
+float DisciplinedClock::get_drift_ppm() const { return this->drift_ppm_; }
+TimeSource DisciplinedClock::get_source() const { return this->source_; }
+uint64_t DisciplinedClock::monotonic_ms_() {
+  const uint32_t now = millis();
+  if (now < this->last_millis_)
+    this->millis_high_ += 1ull << 32;
+  this->last_millis_ = now;
+  return this->millis_high_ | now;
+}
+uint64_t DisciplinedClock::epoch_at_(uint64_t monotonic) {
+  const uint64_t elapsed = monotonic - this->ref_monotonic_;
+  const int64_t drift = int64_t(elapsed * this->drift_ppm_ / 1e6f);
+  const int32_t slewed = std::min<uint64_t>(std::abs(this->slew_), elapsed / SLEW_DIVIDER);
+  return this->ref_epoch_ + elapsed + drift + (this->slew_ < 0 ? -slewed : slewed);
+}
+
+DisciplinedClock global_disciplined_clock;
+
+}  // namespace time
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_TIME
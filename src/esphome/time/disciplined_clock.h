@@ -0,0 +1,73 @@
+#ifndef ESPHOME_TIME_DISCIPLINED_CLOCK_H
+#define ESPHOME_TIME_DISCIPLINED_CLOCK_H
+
+#include "esphome/defines.h"
+
+#ifdef USE_TIME
+
+#include <stdint.h>
+
+ESPHOME_NAMESPACE_BEGIN
+
+namespace time {
+
+/// Where a time sample came from, higher values are more accurate and take precedence.
+enum TimeSource {
+  TIME_SOURCE_NONE = 0,
+  TIME_SOURCE_RTC,
+  TIME_SOURCE_HOMEASSISTANT,
+  TIME_SOURCE_SNTP,
+};
+
+/** A wall clock that runs on millis() and is steered by samples from time sources.
+ *
+ * Instead of setting the time wholesale on every sync, small differences (below a second) are slewed in
+ * gradually so the clock never jumps or runs backwards, and the frequency error of the oscillator is estimated
+ * from the remaining error between syncs and corrected for. Only larger differences step the clock.
+ *
+ * Samples from a lower ranked source are ignored while a higher ranked one has synced recently.
+ */
+class DisciplinedClock {
+ public:
+  /// Feed a time sample, the unix epoch in milliseconds at the time of the call.
+  void synchronize(uint64_t epoch_ms, TimeSource source);
+
+  /// Whether the clock has received a sample yet.
+  bool is_synchronized() const;
+
+  /// Get the unix epoch in milliseconds, 0 if the clock hasn't been synchronized yet.
+  uint64_t get_epoch_ms();
+
+  /// The estimated frequency error of the local oscillator in parts per million.
+  float get_drift_ppm() const;
+
+  /// The source of the last accepted sample.
+  TimeSource get_source() const;
+
+ protected:
+  /// millis() extended to 64 bits so that it doesn't wrap after 49 days.
+  uint64_t monotonic_ms_();
+  /// The (slewed and drift corrected) epoch at a monotonic time.
+  uint64_t epoch_at_(uint64_t monotonic);
+
+  /// The reference point the clock runs from.
+  uint64_t ref_monotonic_{0};
+  uint64_t ref_epoch_{0};
+  /// The correction that's slewed in after the reference point, in ms.
+  int32_t slew_{0};
+  float drift_ppm_{0.0f};
+  uint64_t last_sync_{0};
+  TimeSource source_{TIME_SOURCE_NONE};
+  uint32_t last_millis_{0};
+  uint64_t millis_high_{0};
+};
+
+extern DisciplinedClock global_disciplined_clock;
+
+}  // namespace time
+
+ESPHOME_NAMESPACE_END
+
+#endif  // USE_TIME
+
+#endif  // ESPHOME_TIME_DISCIPLINED_CLOCK_H
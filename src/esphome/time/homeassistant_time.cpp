@@ -6,9 +6,6 @@
 #include "esphome/api/api_server.h"
 #include "esphome/log.h"
 #include "lwip/opt.h"
-#ifdef ARDUINO_ARCH_ESP8266
-#include "sys/time.h"
-#endif
 
 ESPHOME_NAMESPACE_BEGIN
 
@@ -17,11 +14,7 @@ namespace time {
 static const char *TAG = "time.homeassistant";
 
 void HomeAssistantTime::set_epoch_time(uint32_t epoch) {
-  struct timeval timev {
-    .tv_sec = static_cast<time_t>(epoch), .tv_usec = 0,
-  };
-  timezone tz = {0, 0};
-  settimeofday(&timev, &tz);
+  global_disciplined_clock.synchronize(uint64_t(epoch) * 1000u, TIME_SOURCE_HOMEASSISTANT);
 
   auto time = this->now();
   char buf[128];
@@ -11,24 +11,121 @@ namespace time {
 
 static const char *TAG = "time.rtc";
 
+/// Steps in which DST transitions are searched for, no time zone changes its offset twice within a week.
+static const time_t TRANSITION_SEARCH_STEP = 7 * 24 * 60 * 60;
+/// How far ahead DST transitions are searched for.
+static const time_t TRANSITION_SEARCH_RANGE = 366 * 24 * 60 * 60;
+/// Advance the cached time second by second for at most this many seconds, otherwise convert it again.
+static const time_t MAX_INCREMENT_SECONDS = 60;
+
+/// Seconds since the epoch of a broken-down time, without any time zone conversion.
+static time_t tm_to_epoch(const struct tm &c_tm) {
+  // days from civil, see http://howardhinnant.github.io/date_algorithms.html
+  int year = c_tm.tm_year + 1900;
+  const int month = c_tm.tm_mon + 1;
+  year -= month <= 2;
+  const int era = (year >= 0 ? year : year - 399) / 400;
+  const int year_of_era = year - era * 400;
+  const int day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + c_tm.tm_mday - 1;
+  const int day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+  const time_t days = time_t(era) * 146097 + day_of_era - 719468;
+  return days * 86400 + c_tm.tm_hour * 3600 + c_tm.tm_min * 60 + c_tm.tm_sec;
+}
+/// Get the UTC offset in seconds at t, and whether DST is in effect.
+static int32_t get_utc_offset(time_t t, bool *is_dst) {
+  struct tm c_tm;
+  ::localtime_r(&t, &c_tm);
+  if (is_dst != nullptr)
+    *is_dst = c_tm.tm_isdst > 0;
+  return tm_to_epoch(c_tm) - t;
+}
+
 RealTimeClockComponent::RealTimeClockComponent() {}
-void RealTimeClockComponent::set_timezone(const std::string &tz) { this->timezone_ = tz; }
+void RealTimeClockComponent::set_timezone(const std::string &tz) {
+  this->timezone_ = tz;
+  this->next_transition_ = 0;
+  this->cached_valid_ = false;
+}
 std::string RealTimeClockComponent::get_timezone() { return this->timezone_; }
+/// The current unix epoch, from the disciplined clock if it has been synchronized.
+static time_t get_epoch() {
+  if (global_disciplined_clock.is_synchronized())
+    return time_t(global_disciplined_clock.get_epoch_ms() / 1000u);
+  return ::time(nullptr);
+}
+
 ESPTime RealTimeClockComponent::now() {
-  time_t t = ::time(nullptr);
-  struct tm *c_tm = ::localtime(&t);
-  return ESPTime::from_tm(c_tm, t);
+  time_t t = get_epoch();
+  if (t < this->offset_start_ || t >= this->next_transition_)
+    this->update_utc_offset_(t);
+
+  if (this->cached_valid_ && t >= this->cached_.time && t - this->cached_.time <= MAX_INCREMENT_SECONDS) {
+    while (this->cached_.time < t)
+      this->cached_.increment_second();
+    return this->cached_;
+  }
+
+  time_t local = t + this->utc_offset_;
+  struct tm c_tm;
+  ::gmtime_r(&local, &c_tm);
+  this->cached_ = ESPTime::from_tm(&c_tm, t);
+  this->cached_.is_dst = this->is_dst_;
+  this->cached_valid_ = true;
+  return this->cached_;
+}
+time_t RealTimeClockComponent::get_next_transition() const { return this->next_transition_; }
+void RealTimeClockComponent::update_utc_offset_(time_t t) {
+  this->utc_offset_ = get_utc_offset(t, &this->is_dst_);
+  this->offset_start_ = t;
+  this->cached_valid_ = false;
+
+  // find the week in which the offset changes, then the exact second by bisection
+  time_t low = t;
+  time_t high = t + TRANSITION_SEARCH_RANGE;
+  for (time_t probe = t + TRANSITION_SEARCH_STEP; probe < t + TRANSITION_SEARCH_RANGE;
+       probe += TRANSITION_SEARCH_STEP) {
+    bool is_dst;
+    if (get_utc_offset(probe, &is_dst) != this->utc_offset_ || is_dst != this->is_dst_) {
+      high = probe;
+      break;
+    }
+    low = probe;
+  }
+  if (high == t + TRANSITION_SEARCH_RANGE) {
+    // no transition within the range, check again then
+    this->next_transition_ = high;
+    return;
+  }
+  while (high - low > 1) {
+    const time_t mid = low + (high - low) / 2;
+    bool is_dst;
+    if (get_utc_offset(mid, &is_dst) != this->utc_offset_ || is_dst != this->is_dst_) {
+      high = mid;
+    } else {
+      low = mid;
+    }
+  }
+  this->next_transition_ = high;
+  ESP_LOGV(TAG, "UTC offset %d s (DST %s) until %ld", this->utc_offset_, YESNO(this->is_dst_),
+           long(this->next_transition_));
 }
 ESPTime RealTimeClockComponent::utcnow() {
-  time_t t = ::time(nullptr);
+  time_t t = get_epoch();
   struct tm *c_tm = ::gmtime(&t);
   return ESPTime::from_tm(c_tm, t);
 }
+uint64_t RealTimeClockComponent::epoch_ms() {
+  if (global_disciplined_clock.is_synchronized())
+    return global_disciplined_clock.get_epoch_ms();
+  return uint64_t(::time(nullptr)) * 1000u;
+}
 CronTrigger *RealTimeClockComponent::make_cron_trigger() { return new CronTrigger(this); }
 void RealTimeClockComponent::call_setup() {
   this->setup_internal_();
   setenv("TZ", this->timezone_.c_str(), 1);
   tzset();
+  this->next_transition_ = 0;
+  this->cached_valid_ = false;
   this->setup();
 }
 
@@ -7,6 +7,7 @@
 
 #include "esphome/component.h"
 #include "esphome/automation.h"
+#include "esphome/time/disciplined_clock.h"
 #include <stdlib.h>
 #include <time.h>
 #include <bitset>
@@ -107,6 +108,10 @@ class CronTrigger : public Trigger<>, public Component {
 
 /// The RealTimeClock class exposes common timekeeping functions via the device's local real-time clock.
 ///
+/// now() only runs the C library's localtime() when the UTC offset needs to be looked up again (on the first
+/// call, after the clock jumped back or across a DST transition). In between, the local time is derived from
+/// the cached offset and the last result is advanced second by second.
+///
 /// \note
 /// The C library (newlib) available on ESPs only supports TZ strings that specify an offset and DST info;
 /// you cannot specify zone names or paths to zoneinfo files.
@@ -124,15 +129,32 @@ class RealTimeClockComponent : public Component {
   /// Get the time in the currently defined timezone.
   ESPTime now();
 
+  /// Get the next time (unix epoch) at which the UTC offset changes, for example to/from DST.
+  time_t get_next_transition() const;
+
   /// Get the time without any time zone or DST corrections.
   ESPTime utcnow();
 
+  /// Get the unix epoch in milliseconds, from the disciplined clock once a time source has synced it.
+  uint64_t epoch_ms();
+
   CronTrigger *make_cron_trigger();
 
   void call_setup() override;
 
  protected:
+  /// Look up the UTC offset at t and find the next time it changes.
+  void update_utc_offset_(time_t t);
+
   std::string timezone_{};
+  /// The UTC offset (in seconds) and DST flag for [offset_start_, next_transition_).
+  int32_t utc_offset_{0};
+  bool is_dst_{false};
+  time_t offset_start_{0};
+  time_t next_transition_{0};
+  /// The last result of now().
+  ESPTime cached_{};
+  bool cached_valid_{false};
 };
 
 }  // namespace time
@@ -12,7 +12,9 @@
 #endif
 #ifdef ARDUINO_ARCH_ESP8266
 #include "sntp.h"
+#include <coredecls.h>
 #endif
+#include <sys/time.h>
 
 ESPHOME_NAMESPACE_BEGIN
 
@@ -20,6 +22,23 @@ namespace time {
 
 static const char *TAG = "time.sntp";
 
+/// 2018-01-01, anything earlier means SNTP hasn't set the time yet.
+static const time_t MIN_VALID_EPOCH = 1514764800;
+
+// Between syncs the system time runs on the same oscillator as millis(), so it must only be passed on to the
+// disciplined clock right after lwIP's SNTP client has set it. Otherwise the drift estimate would measure the
+// oscillator against itself.
+#ifdef ARDUINO_ARCH_ESP8266
+static volatile bool sntp_time_set = false;
+static void sntp_time_set_callback() { sntp_time_set = true; }
+#endif
+#ifdef ARDUINO_ARCH_ESP32
+/// The SDK has no sync notification, so check this often (in ms) whether the system time was stepped.
+static const uint32_t SNTP_CHECK_INTERVAL = 1000;
+/// A change of the difference between system time and millis() larger than this (in ms) is a sync.
+static const int64_t SNTP_STEP_THRESHOLD = 2;
+#endif
+
 SNTPComponent::SNTPComponent() : RealTimeClockComponent() {
   this->server_1_ = "0.pool.ntp.org";
   this->server_2_ = "1.pool.ntp.org";
@@ -48,6 +67,7 @@ void SNTPComponent::setup() {
 #ifdef ARDUINO_ARCH_ESP8266
   // let localtime/gmtime handle timezones, not sntp
   sntp_set_timezone(0);
+  settimeofday_cb(sntp_time_set_callback);
 #endif
   sntp_init();
 }
@@ -65,12 +85,37 @@ void SNTPComponent::set_servers(const std::string &server_1, const std::string &
 }
 float SNTPComponent::get_setup_priority() const { return setup_priority::WIFI; }
 void SNTPComponent::loop() {
+  struct timeval tv;
+#ifdef ARDUINO_ARCH_ESP8266
+  if (!sntp_time_set)
+    return;
+  sntp_time_set = false;
+  gettimeofday(&tv, nullptr);
+  if (tv.tv_sec < MIN_VALID_EPOCH)
+    return;
+  const uint64_t epoch_ms = uint64_t(tv.tv_sec) * 1000u + tv.tv_usec / 1000u;
+#endif
+#ifdef ARDUINO_ARCH_ESP32
+  const uint32_t now = millis();
+  if (now - this->last_check_ < SNTP_CHECK_INTERVAL)
+    return;
+  this->last_check_ = now;
+  gettimeofday(&tv, nullptr);
+  if (tv.tv_sec < MIN_VALID_EPOCH)
+    return;
+  const uint64_t epoch_ms = uint64_t(tv.tv_sec) * 1000u + tv.tv_usec / 1000u;
+  const int64_t offset = int64_t(epoch_ms) - int64_t(millis());
+  const int64_t step = offset - this->last_offset_;
+  this->last_offset_ = offset;
+  if (this->has_time_ && step <= SNTP_STEP_THRESHOLD && step >= -SNTP_STEP_THRESHOLD)
+    return;
+#endif
+
+  global_disciplined_clock.synchronize(epoch_ms, TIME_SOURCE_SNTP);
   if (this->has_time_)
     return;
 
   auto time = this->now();
-  if (!time.is_valid())
-    return;
 
   char buf[128];
   time.strftime(buf, sizeof(buf), "%c");
@@ -35,6 +35,11 @@ class SNTPComponent : public RealTimeClockComponent {
   std::string server_2_;
   std::string server_3_;
   bool has_time_{false};
+#ifdef ARDUINO_ARCH_ESP32
+  uint32_t last_check_{0};
+  /// The difference between the system time and millis() at the last check, it only changes when SNTP syncs.
+  int64_t last_offset_{0};
+#endif
 };
 
 }  // namespace time
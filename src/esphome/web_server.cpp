@@ -388,7 +388,7 @@ void WebServer::handle_binary_sensor_request(AsyncWebServerRequest *request, Url
 
 #ifdef USE_FAN
 void WebServer::on_fan_update(fan::FanState *obj) {
-  if (obj->is_internal())
+  if (obj->is_internal() || obj->get_changed_fields() == 0)
     return;
   this->events_.send(this->fan_json(obj).c_str(), "state");
 }